@@ -0,0 +1,53 @@
+// Per-TRP phase check at 48 kHz: wrap to the nearest frame and test the output band.
+// Double path (fmod + µs division + PhaseTolerance::within_output) vs FramePhase
+// (reciprocal reduction in Q32 ns + integer compare).
+
+#include "bench_util.hpp"
+#include "AES/AES11/2009/core/frame_phase.hpp"
+#include "AES/AES11/2009/core/phase_tolerance.hpp"
+
+#include <cmath>
+#include <vector>
+
+using AES::AES11::_2009::core::FramePhase;
+using AES::AES11::_2009::core::PhaseTolerance;
+
+int main() {
+    constexpr size_t kTrps = 48'000;
+    constexpr int kRounds = 200;
+    constexpr double kRate = 48000.0;
+    std::vector<uint64_t> trp(kTrps), ref(kTrps);
+    uint64_t x = 7;
+    for (size_t i = 0; i < kTrps; ++i) {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        ref[i] = 3'600'000'000'000ULL + i * 20'833ULL; // an hour of uptime
+        trp[i] = ref[i] + (x >> 49) - 4'096;           // ±4 µs around the reference
+    }
+    const FramePhase fp(kRate);
+    const double periodNs = 1e9 / kRate;
+
+    std::vector<uint64_t> dbl, fixed;
+    for (int r = 0; r < kRounds; ++r) {
+        uint64_t t0 = bench::now_ns();
+        size_t pass = 0;
+        for (size_t i = 0; i < kTrps; ++i) {
+            double d = std::fmod(static_cast<double>(trp[i]) - static_cast<double>(ref[i]), periodNs);
+            if (d > periodNs / 2) d -= periodNs;
+            if (d < -periodNs / 2) d += periodNs;
+            pass += PhaseTolerance::within_output(kRate, std::fabs(d) / 1000.0) ? 1 : 0;
+        }
+        bench::do_not_optimize(pass);
+        uint64_t t1 = bench::now_ns();
+        dbl.push_back(t1 - t0);
+
+        t0 = bench::now_ns();
+        pass = 0;
+        for (size_t i = 0; i < kTrps; ++i) pass += fp.within_output(fp.offset(trp[i], ref[i])) ? 1 : 0;
+        bench::do_not_optimize(pass);
+        t1 = bench::now_ns();
+        fixed.push_back(t1 - t0);
+    }
+    bench::print_latency("double fmod + within_output (48000 TRPs)", dbl);
+    bench::print_latency("FramePhase offset + within_output", fixed);
+    return 0;
+}
@@ -0,0 +1,50 @@
+// One day of 1PPS alignment data (86,400 pairs): per-pair within_alignment() +
+// phase_offset_us() (double µs) vs one evaluate_alignment() pass in integer ns.
+
+#include "bench_util.hpp"
+#include "AES/AES11/2009/sync/gps_reference_sync.hpp"
+
+#include <cmath>
+#include <vector>
+
+using AES::AES11::_2009::sync::GPSReferenceSync;
+
+int main() {
+    constexpr size_t kPairs = 86'400;
+    constexpr int kRounds = 50;
+    std::vector<uint64_t> trp(kPairs), pps(kPairs), bitmap((kPairs + 63) / 64);
+    uint64_t x = 1;
+    for (size_t i = 0; i < kPairs; ++i) {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        pps[i] = 1'000'000'000ULL * (i + 1);
+        trp[i] = pps[i] + (x >> 53) - 1'024; // ±1.024 µs
+    }
+
+    std::vector<uint64_t> perPair, batch;
+    for (int r = 0; r < kRounds; ++r) {
+        uint64_t t0 = bench::now_ns();
+        size_t pass = 0;
+        double worst = 0.0, sum = 0.0, sumSq = 0.0;
+        for (size_t i = 0; i < kPairs; ++i) {
+            pass += GPSReferenceSync::within_alignment(trp[i], pps[i]) ? 1 : 0;
+            const double us = GPSReferenceSync::phase_offset_us(trp[i], pps[i]);
+            worst = us > worst ? us : worst;
+            const double signedUs = trp[i] >= pps[i] ? us : -us;
+            sum += signedUs;
+            sumSq += signedUs * signedUs;
+        }
+        bench::do_not_optimize(pass);
+        bench::do_not_optimize(worst + sum + std::sqrt(sumSq));
+        uint64_t t1 = bench::now_ns();
+        perPair.push_back(t1 - t0);
+
+        t0 = bench::now_ns();
+        const auto st = GPSReferenceSync::evaluate_alignment(trp.data(), pps.data(), kPairs, 1'000, bitmap.data());
+        bench::do_not_optimize(st);
+        t1 = bench::now_ns();
+        batch.push_back(t1 - t0);
+    }
+    bench::print_latency("per-pair (86400 calls)", perPair);
+    bench::print_latency("evaluate_alignment + bitmap", batch);
+    return 0;
+}
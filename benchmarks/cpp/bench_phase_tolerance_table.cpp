@@ -0,0 +1,51 @@
+// Per-TRP output/input band checks at 48 kHz: double API (frame period division on
+// every call) vs the rate-index handle (table load + integer compare in ps).
+
+#include "bench_util.hpp"
+#include "AES/AES11/2009/core/phase_tolerance.hpp"
+
+#include <vector>
+
+using AES::AES11::_2009::core::PhaseTolerance;
+
+int main() {
+    constexpr size_t kTrps = 48'000;
+    constexpr int kRounds = 200;
+    std::vector<uint64_t> offsetPs(kTrps);
+    std::vector<double> offsetUs(kTrps);
+    uint64_t x = 11;
+    for (size_t i = 0; i < kTrps; ++i) {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        offsetPs[i] = (x >> 41) % 6'000'000; // 0..6 µs
+        offsetUs[i] = static_cast<double>(offsetPs[i]) / 1e6;
+    }
+    volatile uint32_t rateHz = 48000; // resolved at run time, as from a stream
+    const double sr = rateHz;
+    const auto idx = PhaseTolerance::rate_index(rateHz);
+
+    std::vector<uint64_t> dbl, table;
+    for (int r = 0; r < kRounds; ++r) {
+        uint64_t t0 = bench::now_ns();
+        size_t pass = 0;
+        for (size_t i = 0; i < kTrps; ++i) {
+            pass += PhaseTolerance::within_output(sr, offsetUs[i]) ? 1 : 0;
+            pass += PhaseTolerance::within_input(sr, offsetUs[i]) ? 1 : 0;
+        }
+        bench::do_not_optimize(pass);
+        uint64_t t1 = bench::now_ns();
+        dbl.push_back(t1 - t0);
+
+        t0 = bench::now_ns();
+        pass = 0;
+        for (size_t i = 0; i < kTrps; ++i) {
+            pass += PhaseTolerance::within_output(idx, offsetPs[i]) ? 1 : 0;
+            pass += PhaseTolerance::within_input(idx, offsetPs[i]) ? 1 : 0;
+        }
+        bench::do_not_optimize(pass);
+        t1 = bench::now_ns();
+        table.push_back(t1 - t0);
+    }
+    bench::print_latency("double within_output/input (48000 TRPs)", dbl);
+    bench::print_latency("RateIndex within_output/input", table);
+    return 0;
+}
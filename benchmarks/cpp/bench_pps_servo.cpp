@@ -0,0 +1,42 @@
+// Per-PPS-tick cost of disciplining many receivers in one thread: an array of PpsServo
+// updated once per simulated second (no allocation after setup).
+
+#include "bench_util.hpp"
+#include "AES/AES11/2009/sync/pps_servo.hpp"
+
+#include <vector>
+
+using AES::AES11::_2009::sync::PpsServo;
+
+int main() {
+    constexpr size_t kTicks = 200;
+    for (size_t n : {100u, 10'000u, 100'000u}) {
+        std::vector<PpsServo> servos(n);
+        std::vector<double> offsetNs(n), freqPpb(n);
+        for (size_t i = 0; i < n; ++i) {
+            offsetNs[i] = static_cast<double>(i % 1000) * 37.0;
+            freqPpb[i] = static_cast<double>(i % 401) * 10.0 - 2000.0;
+        }
+        std::vector<uint64_t> lat;
+        lat.reserve(kTicks);
+        size_t locked = 0;
+        uint64_t pps = 1'000'000'000ULL;
+        for (size_t tick = 0; tick < kTicks; ++tick, pps += 1'000'000'000ULL) {
+            const uint64_t t0 = bench::now_ns();
+            for (size_t i = 0; i < n; ++i) {
+                const uint64_t trp = static_cast<uint64_t>(static_cast<int64_t>(pps) + static_cast<int64_t>(offsetNs[i]));
+                const PpsServo::Output out = servos[i].update(trp, pps);
+                offsetNs[i] += static_cast<double>(out.phaseCorrectionNs) - (freqPpb[i] + out.frequencyCorrectionPpb);
+            }
+            lat.push_back(bench::now_ns() - t0);
+        }
+        for (const auto& s : servos) locked += s.locked() ? 1 : 0;
+        char label[64];
+        std::snprintf(label, sizeof(label), "n=%zu tick (%zu locked)", n, locked);
+        std::vector<uint64_t> copy = lat;
+        const double perServo = static_cast<double>(bench::percentile(copy, 50.0)) / static_cast<double>(n);
+        bench::print_latency(label, lat);
+        std::printf("%-32s %.1f ns per servo update (p50)\n", "", perServo);
+    }
+    return 0;
+}
@@ -0,0 +1,44 @@
+// Accelerated soak: a simulated week (default) of four DARS sources with jitter, a
+// frequency offset and a dropout, replayed through the synchronization chain on a
+// virtual clock. Reports simulated seconds per wall second.
+// Usage: bench_replay_soak [days] [trps-per-second]
+
+#include "bench_util.hpp"
+#include "AES/AES11/2009/sync/timing_replay.hpp"
+
+#include <cstdlib>
+
+using AES::AES11::_2009::sync::SyntheticTimeline;
+using AES::AES11::_2009::sync::TimingReplay;
+
+int main(int argc, char** argv) {
+    const double days = argc > 1 ? std::atof(argv[1]) : 7.0;
+    const unsigned trpRate = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : 10;
+    constexpr uint64_t kSecond = 1'000'000'000ULL;
+    constexpr uint64_t kHour = 3600 * kSecond;
+
+    SyntheticTimeline::Config tc;
+    tc.trpDecimation = trpRate ? 48000 / trpRate : 4800;
+    tc.durationNs = static_cast<uint64_t>(days * 24.0 * 3600.0) * kSecond;
+    tc.sources = {{0.0, 10.0, 0, 0, 0},
+                  {0.0, 20.0, 0, 30 * kHour, 32 * kHour},
+                  {0.5, 10.0, 0, 0, 0},
+                  {0.0, 10.0, 2'000, 0, 0}};
+    SyntheticTimeline timeline(tc);
+
+    TimingReplay::Config rc;
+    rc.sourceCount = tc.sources.size();
+    rc.trpDecimation = tc.trpDecimation;
+    TimingReplay replay(rc);
+    const TimingReplay::Report r = replay.run(timeline);
+
+    std::printf("simulated %.1f h in %.3f s wall: %.0f simulated-s per wall-s\n",
+                static_cast<double>(r.simulatedNs) / 3.6e12, static_cast<double>(r.wallNs) * 1e-9,
+                r.simulatedSecondsPerWallSecond());
+    std::printf("events=%llu trp=%llu pps=%llu selections=%llu switches=%llu selected=%zu\n",
+                static_cast<unsigned long long>(r.events), static_cast<unsigned long long>(r.trpEvents),
+                static_cast<unsigned long long>(r.ppsEvents), static_cast<unsigned long long>(r.selections),
+                static_cast<unsigned long long>(r.switches), r.selected);
+    std::printf("%.1f ns/event\n", r.events ? static_cast<double>(r.wallNs) / static_cast<double>(r.events) : 0.0);
+    return 0;
+}
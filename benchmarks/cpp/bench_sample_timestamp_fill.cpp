@@ -0,0 +1,36 @@
+// Per-sample timestamp cost: SampleTimestampInterpolator::fill() for whole buffers versus
+// timestamp() called once per sample.
+
+#include "bench_util.hpp"
+#include "AES/AES11/2009/core/sample_timestamp_interpolator.hpp"
+
+#include <vector>
+
+using AES::AES11::_2009::core::SampleTimestampInterpolator;
+using AES::AES11::_2009::core::TimingSnapshot;
+
+int main() {
+    SampleTimestampInterpolator interp({48000.0, 1'000'000});
+    interp.addTrp(TimingSnapshot{0, 1'000'000, 1, 0}, 0);
+    interp.addTrp(TimingSnapshot{0, 1'000'000 + 1'333'333, 2, 0}, 64);
+    for (size_t buffer : {64u, 256u, 4096u}) {
+        std::vector<uint64_t> out(buffer);
+        const size_t iterations = 20'000'000 / buffer;
+        uint64_t t0 = bench::now_ns();
+        for (size_t it = 0; it < iterations; ++it) {
+            interp.fill(64 + it, out.data(), out.size());
+            bench::do_not_optimize(out.data()[buffer - 1]);
+        }
+        const uint64_t bulk = bench::now_ns() - t0;
+        t0 = bench::now_ns();
+        for (size_t it = 0; it < iterations; ++it) {
+            for (size_t i = 0; i < buffer; ++i) out[i] = interp.timestamp(64 + it + i);
+            bench::do_not_optimize(out.data()[buffer - 1]);
+        }
+        const uint64_t single = bench::now_ns() - t0;
+        const double n = static_cast<double>(iterations * buffer);
+        std::printf("buffer %5zu  fill(): %5.2f ns/sample   timestamp(): %5.2f ns/sample\n", buffer,
+                    static_cast<double>(bulk) / n, static_cast<double>(single) / n);
+    }
+    return 0;
+}
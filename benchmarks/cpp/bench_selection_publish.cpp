@@ -0,0 +1,92 @@
+// Reader-side cost of obtaining the selected reference while a control thread reselects:
+// mutex-guarded SynchronizationManager copy (the current practice) vs SelectionPublisher.
+// The publisher moves the read's store-load fence to the writer (membarrier where
+// available), so the control thread's publish latency is reported too.
+
+#include "bench_util.hpp"
+#include "AES/AES11/2009/sync/selection_publisher.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace AES::AES11::_2009::sync;
+
+namespace {
+
+constexpr size_t kSources = 16;
+constexpr size_t kReads = 200'000;
+constexpr size_t kPublishes = 20'000;
+
+std::vector<SourceMetrics> makeSources() {
+    std::vector<SourceMetrics> s(kSources);
+    for (size_t i = 0; i < kSources; ++i) s[i] = {0.01 * static_cast<double>(i % 3), 5.0 + 0.01 * i, false};
+    return s;
+}
+
+template <typename ReadFn, typename ReselectFn>
+void run(const char* label, ReadFn read, ReselectFn reselect) {
+    std::atomic<bool> done{false};
+    std::thread control([&]() {
+        while (!done.load(std::memory_order_relaxed)) {
+            reselect();
+            std::this_thread::yield();
+        }
+    });
+    std::vector<uint64_t> lat;
+    lat.reserve(kReads);
+    for (size_t i = 0; i < kReads; ++i) {
+        const uint64_t t0 = bench::now_ns();
+        bench::do_not_optimize(read());
+        lat.push_back(bench::now_ns() - t0);
+    }
+    done = true;
+    control.join();
+    bench::print_latency(label, lat);
+}
+
+} // namespace
+
+int main() {
+    {
+        std::mutex mtx;
+        SynchronizationManager mgr(0.05);
+        std::vector<SourceMetrics> sources = makeSources();
+        SelectionSnapshot shared;
+        size_t k = 0;
+        run("mutex read", [&]() {
+            std::lock_guard<std::mutex> lk(mtx);
+            return shared.reference + static_cast<size_t>(shared.metrics.quality);
+        }, [&]() {
+            std::lock_guard<std::mutex> lk(mtx);
+            sources[k++ % kSources].quality += 0.1;
+            shared.reference = mgr.select(sources);
+            shared.metrics = sources[shared.reference];
+        });
+    }
+    {
+        SelectionPublisher publisher;
+        SynchronizationManager mgr(0.05);
+        std::vector<SourceMetrics> sources = makeSources();
+        auto reader = publisher.register_reader();
+        size_t k = 0;
+        run("epoch publisher read", [&]() {
+            auto g = reader.read();
+            return g->reference + static_cast<size_t>(g->metrics.quality);
+        }, [&]() {
+            sources[k++ % kSources].quality += 0.1;
+            publisher.publish_select(mgr, sources);
+        });
+        std::vector<uint64_t> lat;
+        lat.reserve(kPublishes);
+        for (size_t i = 0; i < kPublishes; ++i) {
+            sources[k++ % kSources].quality += 0.1;
+            const uint64_t t0 = bench::now_ns();
+            publisher.publish_select(mgr, sources);
+            lat.push_back(bench::now_ns() - t0);
+        }
+        bench::print_latency("epoch publisher publish", lat);
+    }
+    return 0;
+}
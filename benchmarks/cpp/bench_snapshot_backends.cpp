@@ -0,0 +1,60 @@
+// Snapshots per second of TimingSnapshotService for each clock backend, devirtualized
+// (TimingSnapshotService<Clock>) versus through the ClockInterface adapter.
+
+#include "bench_util.hpp"
+#include "AES/AES11/2009/core/timing_snapshot_service.hpp"
+#include "Common/clocks/linux_clocks.hpp"
+
+using AES::AES11::_2009::core::TimingSnapshotService;
+
+namespace {
+
+struct CounterClock {
+    uint64_t get_tick() { return ++tick; }
+    uint64_t get_time_ns() { return tick * 20'833ULL; }
+    uint64_t tick = 0;
+};
+
+template <typename Clock>
+void run(const char* label, Clock& clk) {
+    constexpr size_t kIterations = 5'000'000;
+    TimingSnapshotService<Clock> svc(clk);
+    const uint64_t t0 = bench::now_ns();
+    for (size_t i = 0; i < kIterations; ++i) {
+        auto s = svc.snapshot();
+        bench::do_not_optimize(s);
+    }
+    const uint64_t t1 = bench::now_ns();
+    const double secs = static_cast<double>(t1 - t0) * 1e-9;
+    std::printf("%-40s %8.2f Msnap/s  %6.2f ns/snap\n", label,
+                static_cast<double>(kIterations) / secs * 1e-6,
+                static_cast<double>(t1 - t0) / static_cast<double>(kIterations));
+}
+
+template <typename Clock>
+void run_both(const char* name, Clock& clk) {
+    char label[64];
+    std::snprintf(label, sizeof(label), "%s (template)", name);
+    run(label, clk);
+    Common::clocks::ClockInterfaceAdapter<Clock> adapter(clk);
+    std::snprintf(label, sizeof(label), "%s (virtual adapter)", name);
+    run<Common::interfaces::ClockInterface>(label, adapter);
+}
+
+} // namespace
+
+int main() {
+    CounterClock counter;
+    run_both("counter", counter);
+#if defined(__linux__)
+    Common::clocks::MonotonicRawClock raw;
+    run_both("CLOCK_MONOTONIC_RAW", raw);
+    Common::clocks::TaiClock tai;
+    run_both("CLOCK_TAI", tai);
+#if defined(COMMON_CLOCKS_HAVE_TSC)
+    Common::clocks::TscClock tsc;
+    run_both("TSC", tsc);
+#endif
+#endif
+    return 0;
+}
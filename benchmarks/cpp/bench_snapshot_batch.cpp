@@ -0,0 +1,61 @@
+// Cost per snapshot for a 64-frame burst: 64 x snapshot() versus one snapshot_batch()
+// into a pre-allocated buffer, for a concrete clock and the ClockInterface adapter.
+
+#include "bench_util.hpp"
+#include "AES/AES11/2009/core/timing_snapshot_service.hpp"
+#include "Common/clocks/linux_clocks.hpp"
+
+using AES::AES11::_2009::core::TimingSnapshot;
+using AES::AES11::_2009::core::TimingSnapshotService;
+
+namespace {
+
+struct CounterClock {
+    uint64_t get_tick() { return ++tick; }
+    uint64_t get_time_ns() { return tick * 20'833ULL; }
+    Common::interfaces::TickTimePair get_tick_time_pair() {
+        ++tick;
+        return {tick, tick * 20'833ULL, 0};
+    }
+    uint64_t tick = 0;
+};
+
+constexpr size_t kBurst = 64;
+constexpr size_t kBursts = 200'000;
+
+template <typename Svc>
+void run(const char* label, Svc& svc) {
+    TimingSnapshot buf[kBurst];
+    uint64_t t0 = bench::now_ns();
+    for (size_t b = 0; b < kBursts; ++b) {
+        for (size_t i = 0; i < kBurst; ++i) buf[i] = svc.snapshot();
+        bench::do_not_optimize(buf);
+    }
+    const uint64_t single = bench::now_ns() - t0;
+    t0 = bench::now_ns();
+    for (size_t b = 0; b < kBursts; ++b) {
+        svc.snapshot_batch(buf, kBurst);
+        bench::do_not_optimize(buf);
+    }
+    const uint64_t batch = bench::now_ns() - t0;
+    const double n = static_cast<double>(kBursts * kBurst);
+    std::printf("%-28s snapshot(): %6.2f ns/snap   snapshot_batch(): %6.2f ns/snap\n", label,
+                static_cast<double>(single) / n, static_cast<double>(batch) / n);
+}
+
+} // namespace
+
+int main() {
+    CounterClock counter;
+    TimingSnapshotService<CounterClock> direct(counter);
+    run("counter (template)", direct);
+    Common::clocks::ClockInterfaceAdapter<CounterClock> adapter(counter);
+    TimingSnapshotService<> virt(adapter);
+    run("counter (virtual adapter)", virt);
+#if defined(__linux__)
+    Common::clocks::MonotonicRawClock raw;
+    TimingSnapshotService<Common::clocks::MonotonicRawClock> rawSvc(raw);
+    run("MONOTONIC_RAW (template)", rawSvc);
+#endif
+    return 0;
+}
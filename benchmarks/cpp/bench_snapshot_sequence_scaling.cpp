@@ -0,0 +1,66 @@
+// Snapshot throughput from 1 to 64 threads: shared sequence counter (snapshot()) versus
+// per-thread leased sequence blocks (snapshot(lease)).
+
+#include "bench_util.hpp"
+#include "AES/AES11/2009/core/timing_snapshot_service.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using AES::AES11::_2009::core::SequenceLease;
+using AES::AES11::_2009::core::TimingSnapshotService;
+
+namespace {
+
+// Stateless clock so the benchmark measures sequence contention, not clock contention.
+struct SteadyClock {
+    Common::interfaces::TickTimePair get_tick_time_pair() {
+        const uint64_t ns = bench::now_ns();
+        return {ns, ns, 0};
+    }
+    uint64_t get_tick() { return bench::now_ns(); }
+    uint64_t get_time_ns() { return bench::now_ns(); }
+};
+
+template <typename Body>
+double run_threads(unsigned threads, size_t perThread, Body body) {
+    std::atomic<unsigned> ready{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> ts;
+    for (unsigned i = 0; i < threads; ++i) {
+        ts.emplace_back([&]() {
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+            body(perThread);
+        });
+    }
+    while (ready.load() != threads) std::this_thread::yield();
+    const uint64_t t0 = bench::now_ns();
+    go.store(true, std::memory_order_release);
+    for (auto& t : ts) t.join();
+    const uint64_t t1 = bench::now_ns();
+    return static_cast<double>(threads * perThread) / (static_cast<double>(t1 - t0) * 1e-9);
+}
+
+} // namespace
+
+int main() {
+    constexpr size_t kPerThread = 500'000;
+    SteadyClock clk;
+    std::printf("threads  shared(Msnap/s)  leased(Msnap/s)\n");
+    for (unsigned threads = 1; threads <= 64; threads *= 2) {
+        TimingSnapshotService<SteadyClock> shared(clk);
+        const double a = run_threads(threads, kPerThread, [&](size_t n) {
+            for (size_t i = 0; i < n; ++i) bench::do_not_optimize(shared.snapshot());
+        });
+        TimingSnapshotService<SteadyClock> leased(clk);
+        const double b = run_threads(threads, kPerThread, [&](size_t n) {
+            SequenceLease lease;
+            for (size_t i = 0; i < n; ++i) bench::do_not_optimize(leased.snapshot(lease));
+        });
+        std::printf("%7u  %15.2f  %15.2f\n", threads, a * 1e-6, b * 1e-6);
+    }
+    return 0;
+}
@@ -0,0 +1,96 @@
+// Selection pass cost when a few sources change per pass: recompute every SourceMetrics
+// from its window and validator then select() (the hand-filled pattern), vs
+// SourceHealthAggregator::push_changes() + best(). The noisy case sends half of each
+// pass's updates to the current ranked backups with out-of-tolerance phases, so the
+// backup list keeps draining and is refilled from the selection tree.
+
+#include "bench_util.hpp"
+#include "AES/AES11/2009/core/phase_tolerance.hpp"
+#include "AES/AES11/2009/sync/source_health_aggregator.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace AES::AES11::_2009;
+
+namespace {
+
+constexpr size_t kUpdatesPerPass = 16;
+constexpr size_t kPasses = 2000;
+
+uint64_t lcg(uint64_t& x) { return x = x * 6364136223846793005ULL + 1442695040888963407ULL; }
+
+void run(size_t n, bool noisy) {
+    const double limitUs = core::PhaseTolerance::input_tolerance_us(48000.0);
+    std::vector<core::IntegerTimingWindowProcessor> windows(n, core::IntegerTimingWindowProcessor(32, 1.0e4));
+    std::vector<double> rates(n, 48000.0);
+    std::vector<int64_t> lastPhase(n, 0);
+    std::vector<sync::SourceMetrics> metrics(n, sync::SourceMetrics{0.0, 0.0, false});
+    sync::SynchronizationManager full(0.1), incremental(0.1);
+    sync::SourceHealthAggregator agg(sync::SourceHealthAggregator::Config{});
+    for (size_t i = 0; i < n; ++i) {
+        agg.add_rate_measurement(i, 48000.0);
+        agg.add_phase_sample(i, static_cast<int64_t>(i % 500));
+        windows[i].addSample(static_cast<int64_t>(i % 500));
+        lastPhase[i] = static_cast<int64_t>(i % 500);
+    }
+    agg.push_changes(incremental);
+
+    uint64_t rng = 1;
+    std::vector<uint64_t> fullLat, incLat;
+    fullLat.reserve(kPasses);
+    incLat.reserve(kPasses);
+    for (size_t pass = 0; pass < kPasses; ++pass) {
+        size_t ids[kUpdatesPerPass];
+        int64_t phases[kUpdatesPerPass];
+        for (size_t k = 0; k < kUpdatesPerPass; ++k) {
+            ids[k] = static_cast<size_t>(lcg(rng) >> 33) % n;
+            phases[k] = static_cast<int64_t>(lcg(rng) >> 54);
+        }
+        if (noisy) {
+            const auto& backups = incremental.backups();
+            for (size_t k = 0; k < kUpdatesPerPass / 2 && k < backups.size(); ++k) {
+                ids[k] = backups[k];
+                phases[k] = 20'000 + static_cast<int64_t>(lcg(rng) >> 50); // beyond input tolerance
+            }
+        }
+
+        uint64_t t0 = bench::now_ns();
+        for (size_t k = 0; k < kUpdatesPerPass; ++k) {
+            windows[ids[k]].addSample(phases[k]);
+            lastPhase[ids[k]] = phases[k];
+        }
+        for (size_t i = 0; i < n; ++i) {
+            const auto w = windows[i].metrics();
+            const auto rc = core::SampleRateValidator::classify(48000, rates[i]);
+            const double absUs = std::fabs(static_cast<double>(lastPhase[i])) / 1000.0;
+            metrics[i].stability = std::sqrt(w.variance) / 1000.0;
+            metrics[i].quality = (rc == core::SampleRateValidator::ValidationCategory::Pass ? 1.0 : 0.0) +
+                                 1.0 - absUs / limitUs;
+            metrics[i].degraded = !w.stable || absUs > limitUs;
+        }
+        bench::do_not_optimize(full.select(metrics));
+        uint64_t t1 = bench::now_ns();
+        fullLat.push_back(t1 - t0);
+
+        t0 = bench::now_ns();
+        for (size_t k = 0; k < kUpdatesPerPass; ++k) agg.add_phase_sample(ids[k], phases[k]);
+        agg.push_changes(incremental);
+        bench::do_not_optimize(incremental.best());
+        t1 = bench::now_ns();
+        incLat.push_back(t1 - t0);
+    }
+    std::printf("n=%zu, %zu updates per pass%s\n", n, kUpdatesPerPass,
+                noisy ? ", half to ranked backups (noisy)" : "");
+    bench::print_latency("  recompute all + select", fullLat);
+    bench::print_latency("  aggregator push + best", incLat);
+}
+
+} // namespace
+
+int main() {
+    for (bool noisy : {false, true}) {
+        for (size_t n : {1'000u, 10'000u}) run(n, noisy);
+    }
+    return 0;
+}
@@ -0,0 +1,71 @@
+// Reference-switching simulation: N generated sources with drift, noise, dropouts and
+// degradations; prints one JSON object per run (switches, suboptimal time, selection
+// latency percentiles, throughput).
+// Usage: bench_switching_sim [--sources N] [--seconds S] [--rate HZ] [--margin M]
+//                            [--mode full|incremental|both] [--noise X] [--drift PPM_PER_HOUR]
+//                            [--dropouts-per-hour R] [--degradations-per-hour R] [--seed K]
+// Without --sources, sweeps 16, 256 and 4096 sources.
+
+#include "AES/AES11/2009/sync/switching_simulation.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using AES::AES11::_2009::sync::SwitchingSimulation;
+
+int main(int argc, char** argv) {
+    SwitchingSimulation::Scenario scenario;
+    scenario.durationNs = 600'000'000'000ULL;
+    scenario.dropoutsPerHour = 2.0;
+    scenario.degradationsPerHour = 1.0;
+    double rateHz = 10.0;
+    double margin = 0.05;
+    const char* mode = "both";
+    std::vector<size_t> sizes = {16, 256, 4096};
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const char* key = argv[i];
+        const char* val = argv[i + 1];
+        if (std::strcmp(key, "--sources") == 0) {
+            sizes = {static_cast<size_t>(std::strtoull(val, nullptr, 10))};
+        } else if (std::strcmp(key, "--seconds") == 0) {
+            scenario.durationNs = static_cast<uint64_t>(std::strtod(val, nullptr) * 1e9);
+        } else if (std::strcmp(key, "--rate") == 0) {
+            rateHz = std::strtod(val, nullptr);
+        } else if (std::strcmp(key, "--margin") == 0) {
+            margin = std::strtod(val, nullptr);
+        } else if (std::strcmp(key, "--mode") == 0) {
+            mode = val;
+        } else if (std::strcmp(key, "--noise") == 0) {
+            scenario.noise = std::strtod(val, nullptr);
+        } else if (std::strcmp(key, "--drift") == 0) {
+            scenario.driftPpmPerHourSpread = std::strtod(val, nullptr);
+        } else if (std::strcmp(key, "--dropouts-per-hour") == 0) {
+            scenario.dropoutsPerHour = std::strtod(val, nullptr);
+        } else if (std::strcmp(key, "--degradations-per-hour") == 0) {
+            scenario.degradationsPerHour = std::strtod(val, nullptr);
+        } else if (std::strcmp(key, "--seed") == 0) {
+            scenario.seed = std::strtoull(val, nullptr, 10);
+        } else {
+            std::fprintf(stderr, "unknown option %s\n", key);
+            return 2;
+        }
+    }
+
+    for (size_t n : sizes) {
+        scenario.sourceCount = n;
+        SwitchingSimulation::Config cfg = SwitchingSimulation::generate(scenario);
+        cfg.selectionRateHz = rateHz;
+        cfg.hysteresisMargin = margin;
+        for (SwitchingSimulation::Mode m : {SwitchingSimulation::Mode::Full, SwitchingSimulation::Mode::Incremental}) {
+            const bool full = m == SwitchingSimulation::Mode::Full;
+            if (std::strcmp(mode, "both") != 0 && std::strcmp(mode, full ? "full" : "incremental") != 0) continue;
+            cfg.mode = m;
+            SwitchingSimulation sim(cfg);
+            std::printf("%s\n", to_json(sim.run(), m, margin).c_str());
+        }
+    }
+    return 0;
+}
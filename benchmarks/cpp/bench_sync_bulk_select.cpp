@@ -0,0 +1,38 @@
+// Selection throughput over large source sets: select() on a vector<SourceMetrics> (AoS,
+// scalar scoring) vs select_bulk() on a SourceTable (SoA, lane-parallel kernel).
+// Build with optimisation (e.g., -DCMAKE_BUILD_TYPE=Release) for meaningful numbers.
+
+#include "bench_util.hpp"
+#include "AES/AES11/2009/sync/source_table.hpp"
+
+#include <vector>
+
+using namespace AES::AES11::_2009::sync;
+
+int main() {
+    for (size_t n : {1'000u, 10'000u, 100'000u}) {
+        std::vector<SourceMetrics> sources(n);
+        for (size_t i = 0; i < n; ++i) {
+            sources[i] = {0.001 * static_cast<double>(i % 97), 5.0 + 1e-6 * static_cast<double>((i * 7919) % n),
+                          (i % 1013) == 0};
+        }
+        SourceTable table(sources);
+        const size_t iterations = 20'000'000 / n;
+
+        SynchronizationManager scalar(0.1), bulk(0.1);
+        uint64_t t0 = bench::now_ns();
+        for (size_t k = 0; k < iterations; ++k) bench::do_not_optimize(scalar.select(sources));
+        uint64_t t1 = bench::now_ns();
+        const double scalarNs = static_cast<double>(t1 - t0) / static_cast<double>(iterations);
+
+        t0 = bench::now_ns();
+        for (size_t k = 0; k < iterations; ++k) bench::do_not_optimize(bulk.select_bulk(table));
+        t1 = bench::now_ns();
+        const double bulkNs = static_cast<double>(t1 - t0) / static_cast<double>(iterations);
+
+        std::printf("n=%-7zu select %10.0f ns (%5.2f ns/source)  select_bulk %10.0f ns (%5.2f ns/source)  x%.2f  %s\n",
+                    n, scalarNs, scalarNs / n, bulkNs, bulkNs / n, scalarNs / bulkNs,
+                    scalar.current() == bulk.current() ? "same" : "MISMATCH");
+    }
+    return 0;
+}
@@ -0,0 +1,64 @@
+// Failover latency versus source count: failover() on the ranked backup list compared with
+// penalising the current source and rescanning with select(). Latency percentiles for
+// failover() come from the manager's own FailoverMetrics path (TimingSnapshotService).
+
+#include "bench_util.hpp"
+#include "AES/AES11/2009/sync/synchronization_manager.hpp"
+#include "Common/clocks/linux_clocks.hpp"
+
+#include <vector>
+
+using AES::AES11::_2009::sync::SourceMetrics;
+using AES::AES11::_2009::sync::SynchronizationManager;
+
+namespace {
+
+struct SteadyClock {
+    uint64_t get_tick() { return bench::now_ns(); }
+    uint64_t get_time_ns() { return bench::now_ns(); }
+};
+
+SourceMetrics metrics_for(size_t i) { return {0.0, 1.0 + 1e-3 * static_cast<double>(i), false}; }
+
+} // namespace
+
+int main() {
+    SteadyClock steady;
+    Common::clocks::ClockInterfaceAdapter<SteadyClock> clk(steady);
+    AES::AES11::_2009::core::TimingSnapshotService<> timing(clk);
+    for (size_t n : {16u, 256u, 4096u}) {
+        constexpr size_t kRounds = 2000;
+        std::vector<uint64_t> ranked;
+        std::vector<uint64_t> rescan;
+        SynchronizationManager mgr(0.1);
+        mgr.attach_timing(&timing);
+        std::vector<SourceMetrics> all(n);
+        for (size_t i = 0; i < n; ++i) {
+            all[i] = metrics_for(i);
+            mgr.update_source(i, all[i]);
+        }
+        for (size_t r = 0; r < kRounds; ++r) {
+            const size_t cur = mgr.best();
+            mgr.failover(cur);
+            ranked.push_back(mgr.failover_metrics().lastLatencyNs);
+            mgr.update_source(cur, metrics_for(cur)); // recover for the next round
+            mgr.best();
+        }
+        SynchronizationManager full(0.1);
+        size_t cur = full.select(all);
+        for (size_t r = 0; r < kRounds; ++r) {
+            const uint64_t t0 = bench::now_ns();
+            all[cur].degraded = true;
+            const size_t next = full.select(all);
+            const uint64_t t1 = bench::now_ns();
+            rescan.push_back(t1 - t0);
+            all[cur].degraded = false;
+            cur = full.select(all);
+            bench::do_not_optimize(next);
+        }
+        std::printf("N=%5zu\n", n);
+        bench::print_latency("  failover() ranked", ranked);
+        bench::print_latency("  degrade + select()", rescan);
+    }
+    return 0;
+}
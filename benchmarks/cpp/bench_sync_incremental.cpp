@@ -0,0 +1,45 @@
+// Cost of reacting to one source update among N candidates: SynchronizationManager::select()
+// rescanning the full vector versus update_source() + best() on the tournament tree.
+
+#include "bench_util.hpp"
+#include "AES/AES11/2009/sync/synchronization_manager.hpp"
+
+#include <vector>
+
+using AES::AES11::_2009::sync::SourceMetrics;
+using AES::AES11::_2009::sync::SynchronizationManager;
+
+int main() {
+    for (size_t n : {8u, 64u, 256u, 1024u, 4096u}) {
+        std::vector<SourceMetrics> sources(n);
+        for (size_t i = 0; i < n; ++i) sources[i] = {0.01 * static_cast<double>(i % 7), 5.0, false};
+        SynchronizationManager full(0.1);
+        SynchronizationManager incremental(0.1);
+        for (size_t i = 0; i < n; ++i) incremental.update_source(i, sources[i]);
+        constexpr size_t kUpdates = 2'000'000;
+        uint64_t rng = 1;
+
+        uint64_t t0 = bench::now_ns();
+        for (size_t k = 0; k < kUpdates; ++k) {
+            rng = rng * 6364136223846793005ULL + 1;
+            const size_t id = static_cast<size_t>(rng >> 33) % n;
+            sources[id].quality = 5.0 + static_cast<double>((rng >> 20) & 0xFF) * 1e-3;
+            bench::do_not_optimize(full.select(sources));
+        }
+        const uint64_t scan = bench::now_ns() - t0;
+
+        rng = 1;
+        t0 = bench::now_ns();
+        for (size_t k = 0; k < kUpdates; ++k) {
+            rng = rng * 6364136223846793005ULL + 1;
+            const size_t id = static_cast<size_t>(rng >> 33) % n;
+            sources[id].quality = 5.0 + static_cast<double>((rng >> 20) & 0xFF) * 1e-3;
+            incremental.update_source(id, sources[id]);
+            bench::do_not_optimize(incremental.best());
+        }
+        const uint64_t inc = bench::now_ns() - t0;
+        std::printf("N=%5zu  select(): %8.1f ns/update   update_source()+best(): %6.1f ns/update\n", n,
+                    static_cast<double>(scan) / kUpdates, static_cast<double>(inc) / kUpdates);
+    }
+    return 0;
+}
@@ -0,0 +1,54 @@
+// Push-side latency of TrpIngestQueue (audio callback path) while a worker thread
+// drains into TimingWindowProcessor. Compares against calling addSample directly.
+
+#include "bench_util.hpp"
+#include "AES/AES11/2009/core/trp_ingest_queue.hpp"
+
+#include <atomic>
+#include <thread>
+
+using AES::AES11::_2009::core::TimingWindowProcessor;
+using AES::AES11::_2009::core::TrpIngestQueue;
+
+int main() {
+    constexpr size_t kIterations = 1'000'000;
+    constexpr uint64_t kPeriodNs = 20'833;
+
+    TrpIngestQueue queue(4096);
+    TimingWindowProcessor window(1024, 1e6);
+    std::atomic<bool> stop{false};
+    std::thread worker([&]() {
+        while (!stop.load(std::memory_order_relaxed)) {
+            if (queue.drain_into(window) == 0) std::this_thread::yield();
+        }
+        queue.drain_into(window);
+    });
+
+    std::vector<uint64_t> lat;
+    lat.reserve(kIterations);
+    uint64_t trp = 0;
+    for (size_t i = 0; i < kIterations; ++i) {
+        trp += kPeriodNs;
+        const uint64_t t0 = bench::now_ns();
+        queue.push(trp);
+        const uint64_t t1 = bench::now_ns();
+        lat.push_back(t1 - t0);
+    }
+    stop.store(true);
+    worker.join();
+    bench::print_latency("TrpIngestQueue::push", lat);
+    std::printf("dropped=%llu of %zu\n", static_cast<unsigned long long>(queue.dropped()), kIterations);
+
+    // Baseline: direct addSample on the callback thread.
+    TimingWindowProcessor direct(1024, 1e6);
+    std::vector<uint64_t> base;
+    base.reserve(kIterations / 10);
+    for (size_t i = 0; i < kIterations / 10; ++i) {
+        const uint64_t t0 = bench::now_ns();
+        direct.addSample(static_cast<double>(kPeriodNs));
+        const uint64_t t1 = bench::now_ns();
+        base.push_back(t1 - t0);
+    }
+    bench::print_latency("TimingWindowProcessor::addSample", base);
+    return 0;
+}
@@ -0,0 +1,49 @@
+// Shared helpers for the standalone micro-benchmarks (timing, percentiles,
+// optimizer barriers). Not part of the library.
+
+#ifndef AES11_BENCHMARKS_BENCH_UTIL_HPP
+#define AES11_BENCHMARKS_BENCH_UTIL_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace bench {
+
+inline uint64_t now_ns() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// Prevents the compiler from discarding a computed value.
+template <typename T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+// Returns the p-th percentile (0..100) of samples; sorts in place.
+inline uint64_t percentile(std::vector<uint64_t>& samples, double p) {
+    if (samples.empty()) return 0;
+    std::sort(samples.begin(), samples.end());
+    size_t idx = static_cast<size_t>(p / 100.0 * static_cast<double>(samples.size() - 1));
+    return samples[idx];
+}
+
+inline void print_latency(const char* label, std::vector<uint64_t>& samples) {
+    std::printf("%-32s p50=%6llu ns  p99=%6llu ns  p99.9=%6llu ns  max=%8llu ns\n", label,
+                static_cast<unsigned long long>(percentile(samples, 50.0)),
+                static_cast<unsigned long long>(percentile(samples, 99.0)),
+                static_cast<unsigned long long>(percentile(samples, 99.9)),
+                static_cast<unsigned long long>(percentile(samples, 100.0)));
+}
+
+} // namespace bench
+
+#endif // AES11_BENCHMARKS_BENCH_UTIL_HPP
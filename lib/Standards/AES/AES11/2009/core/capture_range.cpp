@@ -8,15 +8,20 @@ namespace _2009 {
 namespace core {
 
 bool CaptureRange::within_capture(double absPpmError, Grade grade) {
+    const double limit = capture_limit_ppm(grade);
+    return limit > 0.0 && absPpmError <= limit;
+}
+
+double CaptureRange::capture_limit_ppm(Grade grade) {
     switch (grade) {
     case Grade::Grade1:
         // REQ-F-DARS-003 (±2 ppm)
-        return absPpmError <= 2.0;
+        return 2.0;
     case Grade::Grade2:
         // REQ-F-DARS-003 (±50 ppm)
-        return absPpmError <= 50.0;
+        return 50.0;
     }
-    return false;
+    return 0.0;
 }
 
 double CaptureRange::ppm_error(double expectedHz, double measuredHz) {
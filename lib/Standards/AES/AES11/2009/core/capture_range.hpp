@@ -41,6 +41,9 @@ public:
     // Grade 2: ±50 ppm (capture)
     static bool within_capture(double absPpmError, Grade grade);
 
+    // Capture range limit (ppm) for grade; 0 for an unknown grade.
+    static double capture_limit_ppm(Grade grade);
+
     // Compute absolute ppm error from expected/measured Hz.
     static double ppm_error(double expectedHz, double measuredHz);
 };
@@ -0,0 +1,69 @@
+#include "frame_phase.hpp"
+#include "phase_tolerance.hpp"
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace core {
+
+namespace {
+
+constexpr uint64_t kNsPerSecondQ32 = 1'000'000'000ULL << 32; // < 2^63
+
+uint64_t toQ32(double ns) { return static_cast<uint64_t>(std::llround(std::ldexp(ns, 32))); }
+
+// round(ps * 2^32 / 1000); band values are below 2^31 ps, so ps << 32 fits.
+uint64_t psToQ32(uint64_t ps) { return ((ps << 32) + 500) / 1000; }
+
+// floor(2^94 / d) by binary long division; d in [2^31, 2^60] keeps the quotient below
+// 2^63 and the running remainder below 2^61.
+uint64_t reciprocal94(uint64_t d) {
+    uint64_t rem = 0, q = 0;
+    for (int bit = 94; bit >= 0; --bit) {
+        rem = (rem << 1) | (bit == 94 ? 1u : 0u);
+        if (rem >= d) {
+            rem -= d;
+            q |= uint64_t{1} << bit; // only bits < 64 can be set
+        }
+    }
+    return q;
+}
+
+} // namespace
+
+FramePhase::FramePhase(double sampleRateHz) : _sampleRateHz(sampleRateHz) {
+    if (!(sampleRateHz > 0.0)) return;
+    uint64_t period = 0;
+    const double whole = std::floor(sampleRateHz);
+    if (whole == sampleRateHz && whole < 18446744073709551616.0) {
+        // Integer rates (all AES5 rates): exact rounded division.
+        const uint64_t sr = static_cast<uint64_t>(whole);
+        period = (kNsPerSecondQ32 + sr / 2) / sr;
+    } else {
+        const double ns = 1e9 / sampleRateHz;
+        if (ns < std::ldexp(1.0, 29)) period = toQ32(ns);
+    }
+    if (period < kMinPeriodQ32 || period > kMaxPeriodQ32) return;
+    _periodQ32 = period;
+    _halfPeriodQ32 = period / 2;
+    _recip = reciprocal94(period);
+    const PhaseTolerance::RateIndex index =
+        whole == sampleRateHz && whole <= 4294967295.0 ? PhaseTolerance::rate_index(static_cast<uint32_t>(whole))
+                                                       : PhaseTolerance::RateIndex{};
+    if (index.valid()) {
+        // Standard rates share the integer ps table with the RateIndex checks.
+        const PhaseTolerance::RateBands b = PhaseTolerance::bands(index);
+        _outputTolQ32 = psToQ32(b.outputTolerancePs);
+        _inputTolQ32 = psToQ32(b.inputTolerancePs);
+        _outputWarnQ32 = psToQ32(b.outputWarningPs);
+    } else {
+        _outputTolQ32 = toQ32(PhaseTolerance::output_tolerance_us(sampleRateHz) * 1000.0);
+        _inputTolQ32 = toQ32(PhaseTolerance::input_tolerance_us(sampleRateHz) * 1000.0);
+        _outputWarnQ32 = toQ32(PhaseTolerance::output_warning_threshold_us(sampleRateHz) * 1000.0);
+    }
+}
+
+} // namespace core
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
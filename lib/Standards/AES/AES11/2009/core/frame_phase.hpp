@@ -0,0 +1,105 @@
+// Frame Phase - DES-C-003
+// Fixed-point phase arithmetic on the AES3 frame grid. Phase is periodic in the frame
+// period, so two instants one frame apart are in phase: offsets are reduced modulo the
+// period into a signed value with |offset| <= period / 2. Values are Q32 ns (ns * 2^32),
+// which represents non-integer periods such as 20833.33 ns at 48 kHz to within 2^-33 ns
+// (the rounding accumulates to ~4e-6 ns per second of separation at 48 kHz).
+// Reduction uses a precomputed reciprocal (one 64x64->128 multiply and at most a few
+// subtractions) and tolerance checks are integer compares against the PhaseTolerance
+// bands converted once at construction, so the per-TRP path has no division.
+
+#ifndef AES_AES11_2009_CORE_FRAME_PHASE_HPP
+#define AES_AES11_2009_CORE_FRAME_PHASE_HPP
+
+#include <cmath>
+#include <cstdint>
+
+#include "../../../../Common/math/int128.hpp"
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace core {
+
+// Signed phase offset in Q32 ns.
+struct PhaseOffset {
+    int64_t q32{0};
+
+    static PhaseOffset from_ns(double ns) { return PhaseOffset{std::llround(std::ldexp(ns, 32))}; }
+
+    double ns() const { return std::ldexp(static_cast<double>(q32), -32); }
+    double us() const { return ns() / 1000.0; }
+    uint64_t abs_q32() const { return q32 < 0 ? ~static_cast<uint64_t>(q32) + 1u : static_cast<uint64_t>(q32); }
+    // |offset| rounded to the nearest ps, for the PhaseTolerance RateIndex checks.
+    uint64_t abs_ps() const { return (Common::math::mul_shift_u64(abs_q32(), 1000, 31) + 1) >> 1; }
+
+    friend bool operator==(PhaseOffset a, PhaseOffset b) { return a.q32 == b.q32; }
+    friend bool operator!=(PhaseOffset a, PhaseOffset b) { return a.q32 != b.q32; }
+};
+
+class FramePhase {
+public:
+    // Supported periods: 0.5 ns .. 2^28 ns (sample rates of ~4 Hz to 2 GHz).
+    static constexpr uint64_t kMinPeriodQ32 = uint64_t{1} << 31;
+    static constexpr uint64_t kMaxPeriodQ32 = uint64_t{1} << 60;
+
+    // Invalid (valid() false, every check fails) for rates outside the supported range.
+    explicit FramePhase(double sampleRateHz);
+
+    bool valid() const { return _periodQ32 != 0; }
+    double sample_rate_hz() const { return _sampleRateHz; }
+    uint64_t period_q32() const { return _periodQ32; }
+    double period_ns() const { return std::ldexp(static_cast<double>(_periodQ32), -32); }
+
+    // Position of timeNs on the frame grid anchored at t = 0, in [0, period).
+    uint64_t phase_q32(uint64_t timeNs) const { return valid() ? reduce(timeNs) : 0; }
+
+    // timeNs - referenceNs wrapped to the nearest frame: the signed offset of timeNs from
+    // the closest reference-grid instant. Exact for any pair of uint64 timestamps.
+    PhaseOffset offset(uint64_t timeNs, uint64_t referenceNs) const {
+        if (!valid()) return PhaseOffset{};
+        const bool negative = timeNs < referenceNs;
+        const uint64_t r = reduce(negative ? referenceNs - timeNs : timeNs - referenceNs);
+        // Fold into [-period/2, period/2]; r < period < 2^60 so the casts are exact.
+        int64_t v = r > _halfPeriodQ32 ? static_cast<int64_t>(r) - static_cast<int64_t>(_periodQ32)
+                                       : static_cast<int64_t>(r);
+        return PhaseOffset{negative ? -v : v};
+    }
+
+    // Bands of PhaseTolerance for this rate (inclusive, like within_output/within_input).
+    // For AES5 rates they are the PhaseTolerance::bands() ps table converted to Q32, so a
+    // verdict here matches PhaseTolerance::within_*(rate_index, offset.abs_ps()) to the ps.
+    bool within_output(PhaseOffset o) const { return valid() && o.abs_q32() <= _outputTolQ32; }
+    bool within_input(PhaseOffset o) const { return valid() && o.abs_q32() <= _inputTolQ32; }
+    bool above_output_warning(PhaseOffset o) const { return valid() && o.abs_q32() > _outputWarnQ32; }
+
+    uint64_t output_tolerance_q32() const { return _outputTolQ32; }
+    uint64_t input_tolerance_q32() const { return _inputTolQ32; }
+    uint64_t output_warning_q32() const { return _outputWarnQ32; }
+
+private:
+    // (n * 2^32) mod period. q = floor(n * recip / 2^62) with recip = floor(2^94 / period)
+    // undershoots the true quotient by at most n / 2^62 + 1 <= 5, so the remainder taken
+    // modulo 2^64 stays below 6 * period < 2^63 (exact) and a short loop finishes it.
+    uint64_t reduce(uint64_t n) const {
+        const uint64_t q = Common::math::mul_shift_u64(n, _recip, 62);
+        uint64_t r = (n << 32) - q * _periodQ32;
+        while (r >= _periodQ32) r -= _periodQ32;
+        return r;
+    }
+
+    double _sampleRateHz;
+    uint64_t _periodQ32{0};
+    uint64_t _halfPeriodQ32{0};
+    uint64_t _recip{0};
+    uint64_t _outputTolQ32{0};
+    uint64_t _inputTolQ32{0};
+    uint64_t _outputWarnQ32{0};
+};
+
+} // namespace core
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
+
+#endif // AES_AES11_2009_CORE_FRAME_PHASE_HPP
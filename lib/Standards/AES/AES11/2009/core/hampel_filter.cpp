@@ -0,0 +1,17 @@
+#include "hampel_filter.hpp"
+#include "../../../../Common/reliability/metrics.hpp"
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace core {
+
+void HampelFilter::recordOutlier() {
+    // Outliers are reliability evidence (missed/duplicated TRPs) - PHASE05-RELIABILITY-HOOKS
+    Common::reliability::ReliabilityMetrics::incrementTimingOutlier();
+}
+
+} // namespace core
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
@@ -0,0 +1,241 @@
+// Hampel Outlier Filter - DES-C-003
+// Optional pre-filter for TimingWindowProcessor. A sliding-window running median
+// (two indexed heaps, O(log w) insert/evict, storage fixed at construction) supplies the
+// centre estimate; a second running median over absolute deviations supplies a streaming
+// MAD. Samples further than k * 1.4826 * MAD from the median are rejected or clamped
+// before they reach the window aggregates, and every rejection is counted.
+
+#ifndef AES_AES11_2009_CORE_HAMPEL_FILTER_HPP
+#define AES_AES11_2009_CORE_HAMPEL_FILTER_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "timing_window_processor.hpp"
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace core {
+
+/**
+ * Sliding-window median over the last `window` samples.
+ * Each ring slot is a member of exactly one heap (lower max-heap or upper min-heap) and
+ * tracks its heap position, so evicting the oldest sample is a heap delete, not a search.
+ */
+class RunningMedian {
+public:
+    explicit RunningMedian(size_t window)
+        : _window(window ? window : 1), _values(_window), _inUpper(_window), _pos(_window),
+          _lower(_window), _upper(_window) {}
+
+    void push(double x) {
+        size_t slot;
+        if (_count == _window) {
+            slot = _oldest;
+            erase(slot);
+            _oldest = (_oldest + 1) % _window;
+        } else {
+            slot = (_oldest + _count) % _window;
+            ++_count;
+        }
+        _values[slot] = x;
+        // Route through the lower heap so ordering holds even if eviction emptied it.
+        insert(slot, false);
+        insert(popTop(false), true);
+        rebalance();
+    }
+
+    double median() const {
+        if (_nl == 0) return 0.0;
+        if (_nl > _nu) return _values[_lower[0]];
+        return 0.5 * (_values[_lower[0]] + _values[_upper[0]]);
+    }
+
+    size_t size() const { return _count; }
+    size_t window() const { return _window; }
+
+    void clear() {
+        _count = _oldest = _nl = _nu = 0;
+    }
+
+private:
+    // Heap ordering: lower heap keeps its maximum at the root, upper its minimum.
+    bool above(bool upper, size_t a, size_t b) const {
+        return upper ? _values[a] < _values[b] : _values[a] > _values[b];
+    }
+
+    std::vector<size_t>& heap(bool upper) { return upper ? _upper : _lower; }
+    size_t& heapSize(bool upper) { return upper ? _nu : _nl; }
+
+    void place(bool upper, size_t i, size_t slot) {
+        heap(upper)[i] = slot;
+        _inUpper[slot] = upper;
+        _pos[slot] = i;
+    }
+
+    void siftUp(bool upper, size_t i) {
+        auto& h = heap(upper);
+        const size_t slot = h[i];
+        while (i > 0) {
+            const size_t parent = (i - 1) / 2;
+            if (!above(upper, slot, h[parent])) break;
+            place(upper, i, h[parent]);
+            i = parent;
+        }
+        place(upper, i, slot);
+    }
+
+    void siftDown(bool upper, size_t i) {
+        auto& h = heap(upper);
+        const size_t n = heapSize(upper);
+        const size_t slot = h[i];
+        for (;;) {
+            size_t child = 2 * i + 1;
+            if (child >= n) break;
+            if (child + 1 < n && above(upper, h[child + 1], h[child])) ++child;
+            if (!above(upper, h[child], slot)) break;
+            place(upper, i, h[child]);
+            i = child;
+        }
+        place(upper, i, slot);
+    }
+
+    void insert(size_t slot, bool upper) {
+        const size_t i = heapSize(upper)++;
+        place(upper, i, slot);
+        siftUp(upper, i);
+    }
+
+    size_t popTop(bool upper) {
+        auto& h = heap(upper);
+        const size_t top = h[0];
+        const size_t last = --heapSize(upper);
+        if (last > 0) {
+            place(upper, 0, h[last]);
+            siftDown(upper, 0);
+        }
+        return top;
+    }
+
+    void erase(size_t slot) {
+        const bool upper = _inUpper[slot];
+        auto& h = heap(upper);
+        const size_t i = _pos[slot];
+        const size_t last = --heapSize(upper);
+        if (i != last) {
+            const size_t moved = h[last];
+            place(upper, i, moved);
+            siftUp(upper, i);
+            siftDown(upper, _pos[moved]);
+        }
+    }
+
+    // Keep |lower| == |upper| or |lower| == |upper| + 1.
+    void rebalance() {
+        while (_nl > _nu + 1) insert(popTop(false), true);
+        while (_nu > _nl) insert(popTop(true), false);
+    }
+
+    size_t _window;
+    std::vector<double> _values;  // ring of samples by slot
+    std::vector<bool> _inUpper;   // heap membership by slot
+    std::vector<size_t> _pos;     // heap index by slot
+    std::vector<size_t> _lower;   // max-heap of slots
+    std::vector<size_t> _upper;   // min-heap of slots
+    size_t _count{0};
+    size_t _oldest{0};
+    size_t _nl{0};
+    size_t _nu{0};
+};
+
+class HampelFilter {
+public:
+    enum class Action : uint8_t {
+        Reject, // drop outliers
+        Clamp   // replace outliers by median ± threshold
+    };
+
+    enum class Decision : uint8_t {
+        Accepted,
+        Clamped,
+        Rejected
+    };
+
+    struct Config {
+        size_t window = 15;          // running median window (odd recommended)
+        double k = 3.0;              // threshold in robust standard deviations
+        double minSigma = 0.0;       // floor on robust sigma (avoids rejecting quantised data)
+        size_t warmup = 5;           // samples accepted unfiltered while the window fills
+        Action action = Action::Reject;
+    };
+
+    explicit HampelFilter(const Config& cfg)
+        : _cfg(cfg), _median(cfg.window), _deviation(cfg.window) {}
+
+    // Classify x against the current window; out receives the value to aggregate (x, or the
+    // clamped value). The raw sample always enters the median window so that genuine step
+    // changes are accepted once they dominate the window.
+    Decision filter(double x, double& out) {
+        Decision d = Decision::Accepted;
+        out = x;
+        const double med = _median.median();
+        const double dev = std::fabs(x - med);
+        if (_median.size() >= _cfg.warmup) {
+            double sigma = 1.4826 * _deviation.median();
+            if (sigma < _cfg.minSigma) sigma = _cfg.minSigma;
+            const double limit = _cfg.k * sigma;
+            if (dev > limit) {
+                if (_cfg.action == Action::Clamp) {
+                    out = x > med ? med + limit : med - limit;
+                    d = Decision::Clamped;
+                    ++_clamped;
+                } else {
+                    d = Decision::Rejected;
+                    ++_rejected;
+                }
+                recordOutlier();
+            }
+        }
+        _median.push(x);
+        _deviation.push(_median.size() > 1 ? dev : 0.0);
+        return d;
+    }
+
+    // Filter x and, unless rejected, add it to the window. Returns the decision.
+    Decision feed(TimingWindowProcessor& window, double x) {
+        double v = 0.0;
+        const Decision d = filter(x, v);
+        if (d != Decision::Rejected) window.addSample(v);
+        return d;
+    }
+
+    uint64_t rejected() const { return _rejected; }
+    uint64_t clamped() const { return _clamped; }
+    double median() const { return _median.median(); }
+
+    void clear() {
+        _median.clear();
+        _deviation.clear();
+        _rejected = 0;
+        _clamped = 0;
+    }
+
+private:
+    static void recordOutlier();
+
+    Config _cfg;
+    RunningMedian _median;
+    RunningMedian _deviation;
+    uint64_t _rejected{0};
+    uint64_t _clamped{0};
+};
+
+} // namespace core
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
+
+#endif // AES_AES11_2009_CORE_HAMPEL_FILTER_HPP
@@ -0,0 +1,3 @@
+#include "integer_timing_window.hpp"
+
+// Implementation in header; this TU anchors the component for the build.
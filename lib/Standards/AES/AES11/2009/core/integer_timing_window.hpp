@@ -0,0 +1,138 @@
+// Integer Timing Window Processor - DES-C-003
+// Drift-free counterpart to TimingWindowProcessor for absolute nanosecond timestamps.
+// Samples are held as int64 ns in a fixed ring; aggregates are exact integer sums of
+// offsets from a rebased epoch (sum in int64, sum of squares in 128-bit), updated in O(1)
+// per sample with no periodic recomputation. Variance is therefore bit-exact regardless
+// of uptime; only the final conversion to double rounds.
+
+#ifndef AES_AES11_2009_CORE_INTEGER_TIMING_WINDOW_HPP
+#define AES_AES11_2009_CORE_INTEGER_TIMING_WINDOW_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../../../../Common/math/int128.hpp"
+#include "timing_window_processor.hpp"
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace core {
+
+class IntegerTimingWindowProcessor {
+public:
+    using Metrics = TimingWindowProcessor::Metrics;
+    using Int128 = Common::math::Int128;
+
+    // Offsets from the epoch are kept below 2^40 ns (~18 min) and capacity below 2^22,
+    // which bounds |sum| < 2^62 and n * sumSquares < 2^124 (no overflow anywhere).
+    static constexpr int64_t kRebaseLimitNs = int64_t{1} << 40;
+    static constexpr size_t kMaxCapacity = size_t{1} << 22;
+
+    struct ExactMetrics {
+        size_t count;
+        int64_t epochNs;             // current rebase epoch
+        int64_t sumOffsetNs;         // sum of (sample - epoch)
+        Int128 sumSquaresNs2;        // sum of (sample - epoch)^2
+        Int128 varianceNumerator;    // n * sumSquares - sum^2 == n^2 * population variance
+    };
+
+    // Window spread (max - min sample) must stay below kRebaseLimitNs.
+    explicit IntegerTimingWindowProcessor(size_t capacity, double varianceThresholdNs2)
+        : _capacity(std::max<size_t>(1, std::min(capacity, kMaxCapacity))),
+          _varianceThreshold(varianceThresholdNs2), _samples(_capacity) {}
+
+    void addSample(int64_t valueNs) {
+        if (_count == _capacity) {
+            const int64_t old = offset(_samples[_head]);
+            _sum -= old;
+            _sumSq -= Int128::mul(old, old);
+            _head = next(_head);
+            --_count;
+        }
+        if (_count == 0) {
+            _epoch = valueNs;
+            _sum = 0;
+            _sumSq = Int128{};
+        } else if (!fitsEpoch(valueNs)) {
+            rebase(valueNs);
+        }
+        const int64_t off = offset(valueNs);
+        _samples[slot(_count)] = valueNs;
+        ++_count;
+        _sum += off;
+        _sumSq += Int128::mul(off, off);
+    }
+
+    Metrics metrics() const {
+        if (_count == 0) return {0, 0.0, 0.0, 0.0 < _varianceThreshold};
+        const double n = static_cast<double>(_count);
+        const double mean = static_cast<double>(_epoch) + static_cast<double>(_sum) / n;
+        const double variance = varianceNumerator().to_double() / (n * n);
+        return {_count, mean, variance, variance < _varianceThreshold};
+    }
+
+    ExactMetrics exactMetrics() const {
+        return {_count, _epoch, _sum, _sumSq, varianceNumerator()};
+    }
+
+    // Mean relative to the current epoch; avoids the precision loss of the absolute mean.
+    double meanOffsetNs() const {
+        return _count ? static_cast<double>(_sum) / static_cast<double>(_count) : 0.0;
+    }
+
+    void clear() {
+        _head = 0;
+        _count = 0;
+        _epoch = 0;
+        _sum = 0;
+        _sumSq = Int128{};
+    }
+
+private:
+    // Offset arithmetic in unsigned space so wrap is defined; callers keep it in range.
+    int64_t offset(int64_t v) const {
+        return static_cast<int64_t>(static_cast<uint64_t>(v) - static_cast<uint64_t>(_epoch));
+    }
+
+    bool fitsEpoch(int64_t v) const {
+        const int64_t off = offset(v);
+        return off < kRebaseLimitNs && off > -kRebaseLimitNs;
+    }
+
+    // Move the epoch to the midpoint of the current mean and the incoming sample, then
+    // shift the aggregates exactly: S1' = S1 - n*d, S2' = S2 - 2*d*S1 + n*d^2.
+    void rebase(int64_t incomingNs) {
+        const int64_t meanOff = _sum / static_cast<int64_t>(_count);
+        const int64_t d = meanOff + (offset(incomingNs) - meanOff) / 2;
+        const int64_t n = static_cast<int64_t>(_count);
+        _sumSq = _sumSq - Int128::mul(d, _sum) * 2 + Int128::mul(d, d) * n;
+        _sum -= n * d;
+        _epoch = static_cast<int64_t>(static_cast<uint64_t>(_epoch) + static_cast<uint64_t>(d));
+    }
+
+    Int128 varianceNumerator() const {
+        return _sumSq * static_cast<int64_t>(_count) - Int128::mul(_sum, _sum);
+    }
+
+    size_t next(size_t i) const { return (i + 1 == _capacity) ? 0 : i + 1; }
+    size_t slot(size_t k) const { return (_head + k) % _capacity; }
+
+    size_t _capacity;
+    double _varianceThreshold;
+    std::vector<int64_t> _samples; // ring storage, allocated once
+    size_t _head{0};
+    size_t _count{0};
+    int64_t _epoch{0};
+    int64_t _sum{0};
+    Int128 _sumSq{};
+};
+
+} // namespace core
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
+
+#endif // AES_AES11_2009_CORE_INTEGER_TIMING_WINDOW_HPP
@@ -0,0 +1,16 @@
+#include "phase_frequency_estimator.hpp"
+
+// Implementation in header (class template); explicit instantiations anchor both variants.
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace core {
+
+template class PhaseFrequencyEstimator<2>;
+template class PhaseFrequencyEstimator<3>;
+
+} // namespace core
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
@@ -0,0 +1,191 @@
+// Phase/Frequency Estimator - DES-C-003
+// Fixed-size Kalman filter separating phase offset, fractional frequency error and drift
+// of a DARS input from its TRP timestamps. State is [phase ns, frequency ns/s, drift ns/s^2]
+// (3-state) or [phase, frequency] (2-state); matrices are std::array sized at compile time
+// so update() never allocates. Measurement is the TRP phase against the nominal frame grid,
+// so missed TRPs are absorbed by grid-index rounding instead of corrupting the estimate.
+
+#ifndef AES_AES11_2009_CORE_PHASE_FREQUENCY_ESTIMATOR_HPP
+#define AES_AES11_2009_CORE_PHASE_FREQUENCY_ESTIMATOR_HPP
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace core {
+
+struct PhaseFrequencyEstimate {
+    double phaseOffsetNs;   // TRP minus reference grid, wrapped to [-T/2, T/2)
+    double frequencyPpm;    // fractional frequency error vs nominal, ppm
+    double driftPpmPerSec;  // frequency drift rate (0 for the 2-state filter)
+    double phaseStdDevNs;   // 1-sigma phase uncertainty from the filter covariance
+    uint64_t samples;       // TRPs consumed since reset
+
+    // Inputs for CaptureRange::within_capture
+    double abs_ppm_error() const { return std::fabs(frequencyPpm); }
+    // Inputs for PhaseTolerance::within_input / within_output
+    double abs_phase_offset_us() const { return std::fabs(phaseOffsetNs) / 1000.0; }
+};
+
+template <size_t N>
+class PhaseFrequencyEstimator {
+    static_assert(N == 2 || N == 3, "PhaseFrequencyEstimator supports 2 or 3 states");
+
+public:
+    struct Config {
+        double measurementNoiseNs = 10.0;   // 1-sigma TRP timestamp noise
+        double processNoise = 1.0;          // spectral density on highest-order state
+        double initialFrequencyPpm = 100.0; // 1-sigma prior on frequency error
+        double initialDriftPpmPerSec = 1.0; // 1-sigma prior on drift (3-state only)
+    };
+
+    explicit PhaseFrequencyEstimator(double nominalSampleRateHz, Config cfg = Config{})
+        : _periodNs(nominalSampleRateHz > 0.0 ? 1e9 / nominalSampleRateHz : 0.0), _cfg(cfg) {
+        reset();
+    }
+
+    // Align the phase grid to a reference TRP (e.g., the DARS reference). Without this
+    // the grid is anchored at the first TRP and phase is relative to that start.
+    void setGridOrigin(uint64_t referenceTrpNs) {
+        _originNs = static_cast<int64_t>(referenceTrpNs);
+        _originFracNs = 0.0;
+        _haveOrigin = true;
+    }
+
+    // Consume one TRP timestamp; returns the posterior estimate.
+    PhaseFrequencyEstimate update(uint64_t trpNs) {
+        if (_periodNs <= 0.0) return estimate();
+        const int64_t t = static_cast<int64_t>(trpNs);
+        if (!_haveOrigin) setGridOrigin(trpNs);
+        if (_samples > 0) {
+            predict(static_cast<double>(t - _prevNs) * 1e-9);
+        }
+        // Phase against the grid point nearest to the predicted TRP position.
+        const double rel = static_cast<double>(t - _originNs) - _originFracNs;
+        const double k = std::round((rel - _x[0]) / _periodNs);
+        const double z = rel - k * _periodNs;
+        correct(z);
+        advanceOrigin(k);
+        _prevNs = t;
+        ++_samples;
+        return estimate();
+    }
+
+    PhaseFrequencyEstimate estimate() const {
+        double phase = _x[0];
+        if (_periodNs > 0.0) phase -= std::floor(phase / _periodNs + 0.5) * _periodNs;
+        // A fast source makes TRPs arrive early, i.e. phase decreases: negate the phase
+        // rate so frequencyPpm follows the usual (f - f0) / f0 sign convention.
+        return {phase, -_x[1] / 1000.0, N == 3 ? -_x[N - 1] / 1000.0 : 0.0,
+                std::sqrt(_P[0][0]), _samples};
+    }
+
+    void reset() {
+        _x.fill(0.0);
+        for (auto& row : _P) row.fill(0.0);
+        const double r = _cfg.measurementNoiseNs * _cfg.measurementNoiseNs;
+        _P[0][0] = r;
+        _P[1][1] = sq(_cfg.initialFrequencyPpm * 1000.0);
+        if (N == 3) _P[N - 1][N - 1] = sq(_cfg.initialDriftPpmPerSec * 1000.0);
+        _samples = 0;
+        _prevNs = 0;
+        _originNs = 0;
+        _originFracNs = 0.0;
+        _haveOrigin = false;
+    }
+
+    double nominalPeriodNs() const { return _periodNs; }
+
+private:
+    using Vec = std::array<double, N>;
+    using Mat = std::array<std::array<double, N>, N>;
+
+    static constexpr double sq(double v) { return v * v; }
+
+    // x <- F x, P <- F P F^T + Q for constant-velocity (N=2) / constant-acceleration (N=3).
+    void predict(double dt) {
+        Mat F{};
+        for (size_t i = 0; i < N; ++i) F[i][i] = 1.0;
+        F[0][1] = dt;
+        if (N == 3) {
+            F[0][N - 1] = 0.5 * dt * dt;
+            F[1][N - 1] = dt;
+        }
+        Vec x{};
+        for (size_t i = 0; i < N; ++i)
+            for (size_t j = 0; j < N; ++j) x[i] += F[i][j] * _x[j];
+        _x = x;
+
+        Mat FP{};
+        for (size_t i = 0; i < N; ++i)
+            for (size_t j = 0; j < N; ++j)
+                for (size_t k = 0; k < N; ++k) FP[i][j] += F[i][k] * _P[k][j];
+        Mat P{};
+        for (size_t i = 0; i < N; ++i)
+            for (size_t j = 0; j < N; ++j)
+                for (size_t k = 0; k < N; ++k) P[i][j] += FP[i][k] * F[j][k];
+
+        // Discretised white noise on the highest-order state.
+        const double q = _cfg.processNoise;
+        const double dt2 = dt * dt, dt3 = dt2 * dt;
+        if (N == 2) {
+            P[0][0] += q * dt3 / 3.0;
+            P[0][1] += q * dt2 / 2.0;
+            P[1][0] += q * dt2 / 2.0;
+            P[1][1] += q * dt;
+        } else {
+            const double dt4 = dt3 * dt, dt5 = dt4 * dt;
+            const double Q[3][3] = {{dt5 / 20.0, dt4 / 8.0, dt3 / 6.0},
+                                    {dt4 / 8.0, dt3 / 3.0, dt2 / 2.0},
+                                    {dt3 / 6.0, dt2 / 2.0, dt}};
+            for (size_t i = 0; i < N; ++i)
+                for (size_t j = 0; j < N; ++j) P[i][j] += q * Q[i][j];
+        }
+        _P = P;
+    }
+
+    // Scalar measurement of phase (H = [1 0 ...]); no matrix inversion required.
+    void correct(double z) {
+        const double s = _P[0][0] + sq(_cfg.measurementNoiseNs);
+        const double y = z - _x[0];
+        Vec K{};
+        for (size_t i = 0; i < N; ++i) K[i] = _P[i][0] / s;
+        for (size_t i = 0; i < N; ++i) _x[i] += K[i] * y;
+        const Vec row = _P[0];
+        for (size_t i = 0; i < N; ++i)
+            for (size_t j = 0; j < N; ++j) _P[i][j] -= K[i] * row[j];
+    }
+
+    // Move the grid origin by k periods so relative times stay small (no precision loss
+    // over long runs). Integer and fractional parts are tracked separately.
+    void advanceOrigin(double k) {
+        const double adv = k * _periodNs + _originFracNs;
+        const double whole = std::floor(adv);
+        _originNs += static_cast<int64_t>(whole);
+        _originFracNs = adv - whole;
+    }
+
+    double _periodNs;
+    Config _cfg;
+    Vec _x{};
+    Mat _P{};
+    uint64_t _samples{0};
+    int64_t _prevNs{0};
+    int64_t _originNs{0};
+    double _originFracNs{0.0};
+    bool _haveOrigin{false};
+};
+
+using PhaseFrequencyEstimator2 = PhaseFrequencyEstimator<2>;
+using PhaseFrequencyEstimator3 = PhaseFrequencyEstimator<3>;
+
+} // namespace core
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
+
+#endif // AES_AES11_2009_CORE_PHASE_FREQUENCY_ESTIMATOR_HPP
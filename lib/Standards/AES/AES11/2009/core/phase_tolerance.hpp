@@ -11,6 +11,7 @@
 #ifndef AES_AES11_2009_CORE_PHASE_TOLERANCE_HPP
 #define AES_AES11_2009_CORE_PHASE_TOLERANCE_HPP
 
+#include <cstddef>
 #include <cstdint>
 
 namespace AES {
@@ -18,6 +19,20 @@ namespace AES11 {
 namespace _2009 {
 namespace core {
 
+namespace detail {
+// round(1e12 ps * permille / (1000 * rate)): a fraction of the frame period in integer ps.
+constexpr uint64_t frame_fraction_ps(uint32_t rateHz, uint64_t permille) {
+    return (1'000'000'000ULL * permille + rateHz / 2) / rateHz;
+}
+
+// Row of PhaseTolerance::RateBands: period, output 5%, input 25%, warning 4.5%.
+template <typename Bands>
+constexpr Bands make_bands(uint32_t rateHz) {
+    return Bands{rateHz, frame_fraction_ps(rateHz, 1000), frame_fraction_ps(rateHz, 50),
+                 frame_fraction_ps(rateHz, 250), frame_fraction_ps(rateHz, 45)};
+}
+} // namespace detail
+
 /**
  * @brief Phase tolerance evaluator for Timing Reference Point (TRP)
  *
@@ -59,8 +74,82 @@ public:
      * @brief Returns true if absolute phase offset (µs) is within input tolerance (±25%)
      */
     static bool within_input(double sampleRateHz, double absPhaseOffsetUs);
+
+    /**
+     * @brief Handle to a precomputed tolerance row (see rate_index())
+     *
+     * Resolve once per stream; per-sample checks are then a table load and an
+     * integer compare. An invalid handle fails every check.
+     */
+    struct RateIndex {
+        uint8_t value{kInvalidRate};
+        constexpr bool valid() const { return value < kRateCount; }
+    };
+
+    /**
+     * @brief Frame period and tolerance bands for one rate, in integer picoseconds
+     *
+     * Each value is rounded to the nearest ps from the same percentages as the
+     * double API (period 1e12 / rate; output 5%, input 25%, warning 4.5%).
+     */
+    struct RateBands {
+        uint32_t sampleRateHz;
+        uint64_t framePeriodPs;
+        uint64_t outputTolerancePs;
+        uint64_t inputTolerancePs;
+        uint64_t outputWarningPs;
+    };
+
+    /**
+     * @brief Handle for the rates SampleRateValidator::is_aes5_standard() accepts;
+     *        invalid for any other rate (use the double API for those)
+     */
+    static constexpr RateIndex rate_index(uint32_t sampleRateHz) {
+        for (size_t i = 0; i < kRateCount; ++i) {
+            if (kBands[i].sampleRateHz == sampleRateHz) return RateIndex{static_cast<uint8_t>(i)};
+        }
+        return RateIndex{};
+    }
+
+    static constexpr size_t rate_count() { return kRateCount; }
+    static constexpr RateBands bands(RateIndex r) { return r.valid() ? kBands[r.value] : RateBands{0, 0, 0, 0, 0}; }
+    static constexpr uint64_t frame_period_ps(RateIndex r) { return bands(r).framePeriodPs; }
+    static constexpr uint64_t output_tolerance_ps(RateIndex r) { return bands(r).outputTolerancePs; }
+    static constexpr uint64_t input_tolerance_ps(RateIndex r) { return bands(r).inputTolerancePs; }
+    static constexpr uint64_t output_warning_threshold_ps(RateIndex r) { return bands(r).outputWarningPs; }
+
+    /**
+     * @brief Integer counterparts of within_output()/within_input() (inclusive bounds)
+     */
+    static constexpr bool within_output(RateIndex r, uint64_t absPhaseOffsetPs) {
+        return r.valid() && absPhaseOffsetPs <= kBands[r.value].outputTolerancePs;
+    }
+    static constexpr bool within_input(RateIndex r, uint64_t absPhaseOffsetPs) {
+        return r.valid() && absPhaseOffsetPs <= kBands[r.value].inputTolerancePs;
+    }
+    static constexpr bool above_output_warning(RateIndex r, uint64_t absPhaseOffsetPs) {
+        return r.valid() && absPhaseOffsetPs > kBands[r.value].outputWarningPs;
+    }
+
+private:
+    static constexpr size_t kRateCount = 7;
+    static constexpr uint8_t kInvalidRate = 0xFF;
+
+    // Keep in step with SampleRateValidator::is_aes5_standard (checked by the tests).
+    static constexpr RateBands kBands[kRateCount] = {
+        detail::make_bands<RateBands>(32000),  detail::make_bands<RateBands>(44100),
+        detail::make_bands<RateBands>(48000),  detail::make_bands<RateBands>(88200),
+        detail::make_bands<RateBands>(96000),  detail::make_bands<RateBands>(176400),
+        detail::make_bands<RateBands>(192000),
+    };
 };
 
+static_assert(PhaseTolerance::frame_period_ps(PhaseTolerance::rate_index(48000)) == 20'833'333,
+              "48 kHz frame period");
+static_assert(PhaseTolerance::output_tolerance_ps(PhaseTolerance::rate_index(48000)) == 1'041'667,
+              "48 kHz output tolerance");
+static_assert(!PhaseTolerance::rate_index(47999).valid(), "non-standard rates have no row");
+
 } // namespace core
 } // namespace _2009
 } // namespace AES11
@@ -0,0 +1,3 @@
+#include "sample_timestamp_interpolator.hpp"
+
+// Implementation in header; this TU anchors the component for the build.
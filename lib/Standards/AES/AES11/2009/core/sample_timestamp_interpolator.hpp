@@ -0,0 +1,198 @@
+// Sample Timestamp Interpolator - DES-C-003
+// Per-sample nanosecond timestamps from TimingSnapshots taken only at TRP / buffer
+// boundaries. The model is piecewise linear in fixed point: time(s) = base + slope * (s -
+// baseSample) with base and slope in 32.32 ns. Each new TRP starts a segment at the value
+// the previous segment predicts for it (so timestamps are continuous and monotonic across
+// buffers), with slope = rate measured over the last rateBaselineTrps TRPs plus the phase
+// error spread over one TRP interval. Only an error beyond maxStepNs re-anchors on the
+// measurement (a counted step).
+
+#ifndef AES_AES11_2009_CORE_SAMPLE_TIMESTAMP_INTERPOLATOR_HPP
+#define AES_AES11_2009_CORE_SAMPLE_TIMESTAMP_INTERPOLATOR_HPP
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../../../Common/math/int128.hpp"
+#include "timing_snapshot_service.hpp"
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace core {
+
+class SampleTimestampInterpolator {
+public:
+    struct Config {
+        double nominalSampleRateHz = 48000.0; // slope until two TRPs have been seen
+        uint64_t maxStepNs = 1'000'000;       // larger phase errors re-anchor (capped at 2^30)
+        size_t rateBaselineTrps = 8;          // TRP intervals averaged for the rate (1..16)
+    };
+
+    explicit SampleTimestampInterpolator(const Config& cfg)
+        : _cfg(cfg), _nominalSlope(slopeFromRate(cfg.nominalSampleRateHz)) {
+        if (_cfg.maxStepNs > kMaxCorrectionNs) _cfg.maxStepNs = kMaxCorrectionNs;
+        if (_cfg.rateBaselineTrps < 1) _cfg.rateBaselineTrps = 1;
+        if (_cfg.rateBaselineTrps > kMaxBaseline) _cfg.rateBaselineTrps = kMaxBaseline;
+        reset();
+    }
+
+    // Register the snapshot taken at the TRP of sample sampleIndex. Returns false (model
+    // unchanged) unless both sample index and time advance past the previous TRP.
+    bool addTrp(const TimingSnapshot& trp, uint64_t sampleIndex) {
+        if (!_haveAnchor) {
+            _cur = Segment{sampleIndex, trp.time_ns, 0, _nominalSlope};
+            _prev = _cur;
+            remember(sampleIndex, trp.time_ns);
+            _haveAnchor = true;
+            return true;
+        }
+        const Anchor& last = _history[(_historyNext + kHistory - 1) % kHistory];
+        if (sampleIndex <= last.sample || trp.time_ns <= last.ns) return false;
+        const uint64_t span = sampleIndex - last.sample;
+        const Anchor& oldest = _history[(_historyNext + kHistory - _historyCount) % kHistory];
+        const uint64_t measured = divQ32(trp.time_ns - oldest.ns, sampleIndex - oldest.sample);
+
+        uint64_t predNs = 0;
+        uint32_t predFrac = 0;
+        evaluate(_cur, sampleIndex - _cur.baseSample, predNs, predFrac);
+        const int64_t errNs = static_cast<int64_t>(trp.time_ns - predNs);
+        _prev = _cur;
+        if (errNs > static_cast<int64_t>(_cfg.maxStepNs) || errNs < -static_cast<int64_t>(_cfg.maxStepNs)) {
+            // The step would corrupt a rate measured across it: restart the baseline and
+            // keep the previous rate.
+            _cur = Segment{sampleIndex, trp.time_ns, 0, _rate};
+            _historyCount = 0;
+            ++_steps;
+        } else {
+            _rate = measured;
+            // Q32 error (fraction included) over one TRP interval; |err| < 2^31 so no overflow.
+            const int64_t errQ32 = static_cast<int64_t>(static_cast<uint64_t>(errNs) << 32) -
+                                   static_cast<int64_t>(predFrac);
+            const int64_t corr = errQ32 / static_cast<int64_t>(span);
+            const int64_t slope = static_cast<int64_t>(measured) + corr;
+            _cur = Segment{sampleIndex, predNs, predFrac, slope > 0 ? static_cast<uint64_t>(slope) : 1};
+        }
+        remember(sampleIndex, trp.time_ns);
+        return true;
+    }
+
+    // Timestamp of one sample (0 before the first TRP). Samples before the current TRP use
+    // the previous segment; samples before that are extrapolated backwards from it.
+    uint64_t timestamp(uint64_t sampleIndex) const {
+        if (!_haveAnchor) return 0;
+        const Segment& seg = sampleIndex >= _cur.baseSample ? _cur : _prev;
+        uint64_t ns = 0;
+        uint32_t frac = 0;
+        if (sampleIndex >= seg.baseSample) {
+            evaluate(seg, sampleIndex - seg.baseSample, ns, frac);
+            return ns + (frac >> 31); // round to nearest ns
+        }
+        const uint64_t back = Common::math::mul_shift_u64(seg.baseSample - sampleIndex, seg.slope, 32);
+        return seg.baseNs - back;
+    }
+
+    // Timestamps for samples [firstSample, firstSample + count), rounded to the nearest ns.
+    // The bulk of the buffer is filled from independent lanes (n0 + ((f0 + k * slope) >> 32))
+    // that compilers vectorize. Returns false (out untouched) before the first TRP.
+    bool fill(uint64_t firstSample, uint64_t* out, size_t count) const {
+        if (!_haveAnchor) return false;
+        size_t i = 0;
+        for (; i < count && firstSample + i < _cur.baseSample; ++i) out[i] = timestamp(firstSample + i);
+        // Lane k holds f0 + 2^31 (rounding) + k * slope, which must stay below 2^64.
+        const uint64_t block = (~uint64_t{0} - (uint64_t{1} << 33)) / _cur.slope;
+        while (i < count) {
+            uint64_t n0 = 0;
+            uint32_t frac = 0;
+            evaluate(_cur, firstSample + i - _cur.baseSample, n0, frac);
+            const uint64_t f0 = static_cast<uint64_t>(frac) + (uint64_t{1} << 31);
+            const size_t n = count - i < block ? count - i : static_cast<size_t>(block);
+            uint64_t* dst = out + i;
+            const uint64_t slope = _cur.slope;
+            for (size_t k = 0; k < n; ++k) {
+                dst[k] = n0 + ((f0 + static_cast<uint64_t>(k) * slope) >> 32);
+            }
+            i += n;
+        }
+        return true;
+    }
+
+    // Slope of the current segment (rate plus phase correction) and the measured rate alone.
+    double nsPerSample() const { return std::ldexp(static_cast<double>(_cur.slope), -32); }
+    double rateNsPerSample() const { return std::ldexp(static_cast<double>(_rate), -32); }
+    uint64_t steps() const { return _steps; }
+    bool ready() const { return _haveAnchor; }
+
+    void reset() {
+        _cur = _prev = Segment{0, 0, 0, _nominalSlope};
+        _rate = _nominalSlope;
+        _historyNext = 0;
+        _historyCount = 0;
+        _steps = 0;
+        _haveAnchor = false;
+    }
+
+private:
+    static constexpr uint64_t kMaxCorrectionNs = uint64_t{1} << 30;
+    static constexpr size_t kMaxBaseline = 16;
+    static constexpr size_t kHistory = kMaxBaseline + 1;
+
+    struct Anchor {
+        uint64_t sample;
+        uint64_t ns;
+    };
+
+    struct Segment {
+        uint64_t baseSample;
+        uint64_t baseNs;
+        uint32_t baseFrac; // Q32 fraction of a nanosecond
+        uint64_t slope;    // Q32 ns per sample
+    };
+
+    // Exact 96-bit evaluation: base + d * slope, split into whole ns and Q32 fraction.
+    static void evaluate(const Segment& seg, uint64_t d, uint64_t& ns, uint32_t& frac) {
+        const uint64_t whole = Common::math::mul_shift_u64(d, seg.slope, 32);
+        const uint64_t low = ((d * seg.slope) & 0xFFFFFFFFu) + seg.baseFrac;
+        ns = seg.baseNs + whole + (low >> 32);
+        frac = static_cast<uint32_t>(low);
+    }
+
+    // floor(num * 2^32 / den) without 128-bit division (den below 2^32 samples).
+    static uint64_t divQ32(uint64_t num, uint64_t den) {
+        const uint64_t q = num / den;
+        const uint64_t r = num % den;
+        return (q << 32) + (r << 32) / den;
+    }
+
+    // Keep the last rateBaselineTrps + 1 TRPs (the rate spans rateBaselineTrps intervals).
+    void remember(uint64_t sample, uint64_t ns) {
+        _history[_historyNext] = Anchor{sample, ns};
+        _historyNext = (_historyNext + 1) % kHistory;
+        if (_historyCount < _cfg.rateBaselineTrps + 1) ++_historyCount;
+    }
+
+    static uint64_t slopeFromRate(double rateHz) {
+        if (!(rateHz > 0.0)) return uint64_t{1} << 32;
+        return static_cast<uint64_t>(std::llround(std::ldexp(1e9 / rateHz, 32)));
+    }
+
+    Config _cfg;
+    uint64_t _nominalSlope;
+    Segment _cur{};
+    Segment _prev{};
+    uint64_t _rate{0};
+    std::array<Anchor, kHistory> _history{};
+    size_t _historyNext{0};
+    size_t _historyCount{0};
+    uint64_t _steps{0};
+    bool _haveAnchor{false};
+};
+
+} // namespace core
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
+
+#endif // AES_AES11_2009_CORE_SAMPLE_TIMESTAMP_INTERPOLATOR_HPP
@@ -0,0 +1,158 @@
+#include "snapshot_journal.hpp"
+
+#include <cstring>
+#include <limits>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define AES11_SNAPSHOT_JOURNAL_POSIX 1
+#endif
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace core {
+
+#if defined(AES11_SNAPSHOT_JOURNAL_POSIX)
+namespace {
+constexpr char kMagic[8] = {'A', 'E', 'S', '1', '1', 'S', 'N', 'J'};
+
+// Header plus capacity records, or false when that overflows size_t or off_t.
+bool mapping_bytes(uint64_t capacity, size_t& bytes) {
+    if (capacity == 0 || capacity > SnapshotJournal::kMaxCapacity) return false;
+    bytes = sizeof(SnapshotJournalHeader) + static_cast<size_t>(capacity) * sizeof(SnapshotJournalRecord);
+    return static_cast<uint64_t>(bytes) <= static_cast<uint64_t>(std::numeric_limits<off_t>::max());
+}
+
+bool header_valid(const SnapshotJournalHeader* h, size_t fileBytes) {
+    if (fileBytes < sizeof(SnapshotJournalHeader)) return false;
+    if (std::memcmp(h->magic, kMagic, sizeof(kMagic)) != 0) return false;
+    if (h->version != SnapshotJournal::kFormatVersion) return false;
+    if (h->recordSize != sizeof(SnapshotJournalRecord)) return false;
+    size_t needed = 0;
+    return mapping_bytes(h->capacity, needed) && fileBytes >= needed;
+}
+} // namespace
+#endif
+
+SnapshotJournal::~SnapshotJournal() { close(); }
+SnapshotJournalReader::~SnapshotJournalReader() { close(); }
+
+#if defined(AES11_SNAPSHOT_JOURNAL_POSIX)
+
+bool SnapshotJournal::open(const std::string& path, uint64_t capacityRecords) {
+    close();
+    size_t bytes = 0;
+    if (!mapping_bytes(capacityRecords, bytes)) return false;
+    const int fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) return false;
+    struct stat st{};
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        return false;
+    }
+    const bool fresh = st.st_size == 0;
+    if (fresh && ::ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+        ::close(fd);
+        return false;
+    }
+    if (!fresh && static_cast<size_t>(st.st_size) != bytes) {
+        ::close(fd);
+        return false;
+    }
+    void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED) {
+        ::close(fd);
+        return false;
+    }
+    auto* h = static_cast<SnapshotJournalHeader*>(p);
+    if (fresh) {
+        // ftruncate zero-fills: every record starts uncommitted.
+        std::memcpy(h->magic, kMagic, sizeof(kMagic));
+        h->version = kFormatVersion;
+        h->recordSize = sizeof(SnapshotJournalRecord);
+        h->capacity = capacityRecords;
+        h->tail.store(0, std::memory_order_relaxed);
+        h->wrapCount.store(0, std::memory_order_relaxed);
+    } else if (!header_valid(h, bytes) || h->capacity != capacityRecords) {
+        ::munmap(p, bytes);
+        ::close(fd);
+        return false;
+    }
+    _header = h;
+    _records = reinterpret_cast<SnapshotJournalRecord*>(static_cast<char*>(p) + sizeof(SnapshotJournalHeader));
+    _mappedBytes = bytes;
+    _fd = fd;
+    return true;
+}
+
+void SnapshotJournal::close() {
+    if (_header) {
+        ::msync(_header, _mappedBytes, MS_SYNC);
+        ::munmap(_header, _mappedBytes);
+    }
+    if (_fd >= 0) ::close(_fd);
+    _header = nullptr;
+    _records = nullptr;
+    _mappedBytes = 0;
+    _fd = -1;
+}
+
+void SnapshotJournal::flush() {
+    if (_header) ::msync(_header, _mappedBytes, MS_ASYNC);
+}
+
+bool SnapshotJournalReader::open(const std::string& path) {
+    close();
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st{};
+    if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(SnapshotJournalHeader)) {
+        ::close(fd);
+        return false;
+    }
+    const size_t bytes = static_cast<size_t>(st.st_size);
+    void* p = ::mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED) {
+        ::close(fd);
+        return false;
+    }
+    const auto* h = static_cast<const SnapshotJournalHeader*>(p);
+    if (!header_valid(h, bytes)) {
+        ::munmap(p, bytes);
+        ::close(fd);
+        return false;
+    }
+    _header = h;
+    _records = reinterpret_cast<const SnapshotJournalRecord*>(static_cast<const char*>(p) + sizeof(SnapshotJournalHeader));
+    _mappedBytes = bytes;
+    _fd = fd;
+    return true;
+}
+
+void SnapshotJournalReader::close() {
+    if (_header) ::munmap(const_cast<SnapshotJournalHeader*>(_header), _mappedBytes);
+    if (_fd >= 0) ::close(_fd);
+    _header = nullptr;
+    _records = nullptr;
+    _mappedBytes = 0;
+    _fd = -1;
+}
+
+#else // !AES11_SNAPSHOT_JOURNAL_POSIX
+
+bool SnapshotJournal::open(const std::string&, uint64_t) { return false; }
+void SnapshotJournal::close() {}
+void SnapshotJournal::flush() {}
+bool SnapshotJournalReader::open(const std::string&) { return false; }
+void SnapshotJournalReader::close() {}
+
+#endif
+
+} // namespace core
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
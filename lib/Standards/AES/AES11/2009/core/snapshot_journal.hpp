@@ -0,0 +1,149 @@
+// Snapshot Journal - DES-I-002 (Timing Source Interface - evidence capture)
+// Records every TimingSnapshot into a memory-mapped ring file for post-incident analysis.
+// Multiple producers append wait-free: one fetch_add reserves a ticket, the record is
+// written into slot (ticket % capacity) and committed by a release store of ticket + 1.
+// The file header carries magic, format version, capacity, the reservation tail and the
+// wrap count, so a reader can reopen the file after a crash and iterate committed records
+// in place (no parsing or copying). POSIX mmap only; open() fails on other platforms.
+
+#ifndef AES_AES11_2009_CORE_SNAPSHOT_JOURNAL_HPP
+#define AES_AES11_2009_CORE_SNAPSHOT_JOURNAL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "timing_snapshot_service.hpp"
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace core {
+
+struct SnapshotJournalHeader {
+    char magic[8];                     // "AES11SNJ"
+    uint32_t version;                  // kFormatVersion
+    uint32_t recordSize;               // sizeof(SnapshotJournalRecord)
+    uint64_t capacity;                 // records in the ring
+    std::atomic<uint64_t> tail;        // tickets reserved so far (next ticket)
+    std::atomic<uint64_t> wrapCount;   // completed passes over the ring
+    uint8_t reserved[24];              // pad to 64 bytes
+};
+
+struct SnapshotJournalRecord {
+    uint64_t tick;
+    uint64_t time_ns;
+    uint64_t seq;
+    uint64_t uncertainty_ticks;
+    std::atomic<uint64_t> commit;      // ticket + 1 once the record is complete
+};
+
+static_assert(sizeof(SnapshotJournalHeader) == 64, "journal header layout is part of the file format");
+static_assert(sizeof(SnapshotJournalRecord) == 40, "journal record layout is part of the file format");
+// The atomics live in the shared mapping: a lock-based fallback would keep its lock outside
+// the file and break both cross-process visibility and crash recovery.
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "journal atomics must be lock-free");
+
+class SnapshotJournal {
+public:
+    static constexpr uint32_t kFormatVersion = 1;
+    // Largest capacity whose mapping size fits size_t; open() rejects anything above.
+    static constexpr uint64_t kMaxCapacity =
+        (SIZE_MAX - sizeof(SnapshotJournalHeader)) / sizeof(SnapshotJournalRecord);
+
+    SnapshotJournal() = default;
+    ~SnapshotJournal();
+    SnapshotJournal(const SnapshotJournal&) = delete;
+    SnapshotJournal& operator=(const SnapshotJournal&) = delete;
+
+    // Create (or reopen and continue) a journal with capacityRecords slots. An existing
+    // file with a different format or capacity is rejected rather than overwritten, as is
+    // a capacity above kMaxCapacity.
+    bool open(const std::string& path, uint64_t capacityRecords);
+    void close();
+    bool is_open() const { return _header != nullptr; }
+
+    // Wait-free for any number of producer threads. Returns false if not open. Capacity
+    // must exceed the records appended while any one producer is mid-append.
+    bool append(const TimingSnapshot& s) noexcept {
+        if (!_header) return false;
+        const uint64_t ticket = _header->tail.fetch_add(1, std::memory_order_relaxed);
+        const uint64_t cap = _header->capacity;
+        if (ticket != 0 && ticket % cap == 0) _header->wrapCount.fetch_add(1, std::memory_order_relaxed);
+        SnapshotJournalRecord& r = _records[ticket % cap];
+        r.commit.store(0, std::memory_order_relaxed); // invalidate slot while rewriting
+        std::atomic_thread_fence(std::memory_order_release);
+        r.tick = s.tick;
+        r.time_ns = s.time_ns;
+        r.seq = s.seq;
+        r.uncertainty_ticks = s.uncertainty_ticks;
+        r.commit.store(ticket + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Ask the OS to write dirty pages back asynchronously (data already survives a
+    // process crash through the shared mapping; this narrows the window for power loss).
+    void flush();
+
+    uint64_t appended() const { return _header ? _header->tail.load(std::memory_order_relaxed) : 0; }
+
+private:
+    SnapshotJournalHeader* _header{nullptr};
+    SnapshotJournalRecord* _records{nullptr};
+    size_t _mappedBytes{0};
+    int _fd{-1};
+};
+
+class SnapshotJournalReader {
+public:
+    SnapshotJournalReader() = default;
+    ~SnapshotJournalReader();
+    SnapshotJournalReader(const SnapshotJournalReader&) = delete;
+    SnapshotJournalReader& operator=(const SnapshotJournalReader&) = delete;
+
+    // Map an existing journal read-only and validate its header.
+    bool open(const std::string& path);
+    void close();
+
+    uint64_t capacity() const { return _header ? _header->capacity : 0; }
+    uint64_t tail() const { return _header ? _header->tail.load(std::memory_order_acquire) : 0; }
+    uint64_t wrapCount() const { return _header ? _header->wrapCount.load(std::memory_order_acquire) : 0; }
+
+    // Visit committed records oldest-first directly in the mapping: f(ticket, record).
+    // Slots still being written (or torn by a crash) are skipped and counted. Intended for
+    // post-incident reads; a live reader racing a wrapping writer should re-check
+    // record.commit after copying the fields it needs.
+    template <typename F>
+    uint64_t forEach(F&& f, uint64_t* skipped = nullptr) const {
+        if (!_header) return 0;
+        const uint64_t cap = _header->capacity;
+        const uint64_t end = tail();
+        const uint64_t begin = end > cap ? end - cap : 0;
+        uint64_t visited = 0, bad = 0;
+        for (uint64_t t = begin; t < end; ++t) {
+            const SnapshotJournalRecord& r = _records[t % cap];
+            if (r.commit.load(std::memory_order_acquire) != t + 1) {
+                ++bad;
+                continue;
+            }
+            f(t, r);
+            ++visited;
+        }
+        if (skipped) *skipped = bad;
+        return visited;
+    }
+
+private:
+    const SnapshotJournalHeader* _header{nullptr};
+    const SnapshotJournalRecord* _records{nullptr};
+    size_t _mappedBytes{0};
+    int _fd{-1};
+};
+
+} // namespace core
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
+
+#endif // AES_AES11_2009_CORE_SNAPSHOT_JOURNAL_HPP
@@ -0,0 +1,3 @@
+#include "tick_calibrator.hpp"
+
+// Implementation in header; this TU anchors the component for the build.
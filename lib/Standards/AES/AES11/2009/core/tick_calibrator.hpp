@@ -0,0 +1,179 @@
+// Tick Calibrator - DES-I-002 (Timing Source Interface)
+// Converts raw tick counts (e.g., TSC cycles captured in ~20 cycles on the TRP path) to
+// nanoseconds after the fact. Paired TimingSnapshot samples are regressed (weighted least
+// squares, weight 1/(1+uncertainty)^2) into a fixed-point multiply-shift model
+//     ns = baseNs + ((tick - baseTick) * mult) >> shift
+// which is published through a seqlock: readers never block, and conversion costs one
+// widening multiply and a shift.
+
+#ifndef AES_AES11_2009_CORE_TICK_CALIBRATOR_HPP
+#define AES_AES11_2009_CORE_TICK_CALIBRATOR_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../../../../Common/concurrency/seqlock.hpp"
+#include "../../../../Common/math/int128.hpp"
+#include "timing_snapshot_service.hpp"
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace core {
+
+struct TickConversion {
+    uint64_t baseTick;
+    uint64_t baseNs;
+    uint64_t mult;       // ns per tick in fixed point (scaled by 2^shift)
+    uint64_t shift;
+    uint64_t generation; // 0 until the first successful calibration
+
+    // Ticks on either side of baseTick convert (calibration anchors at the newest sample,
+    // so a tick captured before a recalibration lies before the new anchor).
+    uint64_t to_ns(uint64_t tick) const {
+        const unsigned sh = static_cast<unsigned>(shift);
+        if (tick < baseTick) return baseNs - Common::math::mul_shift_u64(baseTick - tick, mult, sh);
+        return baseNs + Common::math::mul_shift_u64(tick - baseTick, mult, sh);
+    }
+
+    double ns_per_tick() const { return std::ldexp(static_cast<double>(mult), -static_cast<int>(shift)); }
+};
+
+class TickCalibrator {
+public:
+    explicit TickCalibrator(size_t maxSamples = 64)
+        : _capacity(maxSamples < 2 ? 2 : maxSamples), _samples(_capacity) {
+        _published.store(TickConversion{0, 0, uint64_t{1} << kMaxShift, kMaxShift, 0});
+    }
+
+    // Writer side: record one paired snapshot (oldest sample is replaced when full).
+    void addSample(const TimingSnapshot& s) {
+        _samples[(_first + _count) % _capacity] = s;
+        if (_count < _capacity) {
+            ++_count;
+        } else {
+            _first = (_first + 1) % _capacity;
+        }
+    }
+
+    // Writer side: fit and publish a new conversion. Returns false with fewer than two
+    // distinct samples or a non-positive slope (previous conversion stays published).
+    bool recalibrate() {
+        if (_count < 2) return false;
+        const TimingSnapshot& anchor = _samples[(_first + _count - 1) % _capacity];
+        double sw = 0.0, sx = 0.0, sy = 0.0, sxx = 0.0, sxy = 0.0;
+        for (size_t i = 0; i < _count; ++i) {
+            const TimingSnapshot& s = _samples[(_first + i) % _capacity];
+            // Centre on the anchor so doubles keep full resolution over long spans.
+            const double x = static_cast<double>(static_cast<int64_t>(s.tick - anchor.tick));
+            const double y = static_cast<double>(static_cast<int64_t>(s.time_ns - anchor.time_ns));
+            const double u = 1.0 + static_cast<double>(s.uncertainty_ticks);
+            const double w = 1.0 / (u * u);
+            sw += w;
+            sx += w * x;
+            sy += w * y;
+            sxx += w * x * x;
+            sxy += w * x * y;
+        }
+        const double denom = sw * sxx - sx * sx;
+        if (!(denom > 0.0)) return false;
+        const double slope = (sw * sxy - sx * sy) / denom;
+        if (!(slope > 0.0)) return false;
+        const double intercept = (sy - slope * sx) / sw; // fitted ns offset at anchor tick
+
+        // Largest shift (<= kMaxShift) that keeps mult below 2^62.
+        unsigned shift = kMaxShift;
+        while (shift > 0 && std::ldexp(slope, static_cast<int>(shift)) >= std::ldexp(1.0, 62)) --shift;
+        const uint64_t mult = static_cast<uint64_t>(std::llround(std::ldexp(slope, static_cast<int>(shift))));
+        const uint64_t baseNs = static_cast<uint64_t>(static_cast<int64_t>(anchor.time_ns) +
+                                                      static_cast<int64_t>(std::llround(intercept)));
+        _published.store(TickConversion{anchor.tick, baseNs, mult, shift, ++_generation});
+        return true;
+    }
+
+    // Reader side (any thread, lock-free).
+    TickConversion conversion() const { return _published.load(); }
+    uint64_t to_ns(uint64_t tick) const { return _published.load().to_ns(tick); }
+
+    size_t sampleCount() const { return _count; }
+
+private:
+    static constexpr unsigned kMaxShift = 32;
+
+    size_t _capacity;
+    std::vector<TimingSnapshot> _samples; // writer-owned ring
+    size_t _first{0};
+    size_t _count{0};
+    uint64_t _generation{0};
+    Common::concurrency::Seqlock<TickConversion> _published;
+};
+
+/**
+ * Background recalibration: every period, takes a snapshot from the service, feeds it to
+ * the calibrator and republishes. Readers keep converting lock-free throughout.
+ */
+template <typename Clock>
+class TickCalibrationWorker {
+public:
+    TickCalibrationWorker(TimingSnapshotService<Clock>& svc, TickCalibrator& cal,
+                          std::chrono::nanoseconds period)
+        : _svc(svc), _cal(cal), _period(period) {}
+
+    ~TickCalibrationWorker() { stop(); }
+
+    TickCalibrationWorker(const TickCalibrationWorker&) = delete;
+    TickCalibrationWorker& operator=(const TickCalibrationWorker&) = delete;
+
+    void start() {
+        if (_thread.joinable()) return;
+        _stop = false;
+        _thread = std::thread([this]() { run(); });
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lk(_mtx);
+            _stop = true;
+        }
+        _cv.notify_all();
+        if (_thread.joinable()) _thread.join();
+    }
+
+    uint64_t cycles() const { return _cycles.load(std::memory_order_relaxed); }
+
+private:
+    void run() {
+        std::unique_lock<std::mutex> lk(_mtx);
+        while (!_stop) {
+            lk.unlock();
+            _cal.addSample(_svc.snapshot());
+            _cal.recalibrate();
+            _cycles.fetch_add(1, std::memory_order_relaxed);
+            lk.lock();
+            _cv.wait_for(lk, _period, [this]() { return _stop; });
+        }
+    }
+
+    TimingSnapshotService<Clock>& _svc;
+    TickCalibrator& _cal;
+    std::chrono::nanoseconds _period;
+    std::thread _thread;
+    std::mutex _mtx;
+    std::condition_variable _cv;
+    bool _stop{false};
+    std::atomic<uint64_t> _cycles{0};
+};
+
+} // namespace core
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
+
+#endif // AES_AES11_2009_CORE_TICK_CALIBRATOR_HPP
@@ -0,0 +1,3 @@
+#include "timing_history.hpp"
+
+// Implementation in header; this TU anchors the component for the build.
@@ -0,0 +1,169 @@
+// Timing History - DES-C-003
+// Fixed-memory, multi-resolution history of a timing metric stream (e.g., TRP jitter of
+// one input). Each sample is folded into the current bucket of every tier (default 1 s,
+// 1 min, 1 h). Buckets hold count/mean/M2/min/max and merge exactly (Chan et al.), so a
+// range query combines at most one tier's worth of buckets instead of rescanning samples.
+// Storage is allocated once at construction; memory per stream is constant.
+
+#ifndef AES_AES11_2009_CORE_TIMING_HISTORY_HPP
+#define AES_AES11_2009_CORE_TIMING_HISTORY_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace core {
+
+class TimingHistory {
+public:
+    static constexpr size_t kTierCount = 3;
+
+    struct TierSpec {
+        uint64_t resolutionNs; // bucket width
+        size_t buckets;        // retained buckets (ring length)
+    };
+
+    struct Summary {
+        uint64_t count{0};
+        double mean{0.0};
+        double m2{0.0}; // sum of squared deviations from mean
+        double min{std::numeric_limits<double>::infinity()};
+        double max{-std::numeric_limits<double>::infinity()};
+
+        double variance() const { return count ? m2 / static_cast<double>(count) : 0.0; } // population
+
+        void add(double x) {
+            ++count;
+            const double delta = x - mean;
+            mean += delta / static_cast<double>(count);
+            m2 += delta * (x - mean);
+            if (x < min) min = x;
+            if (x > max) max = x;
+        }
+
+        void merge(const Summary& o) {
+            if (o.count == 0) return;
+            if (count == 0) {
+                *this = o;
+                return;
+            }
+            const double n = static_cast<double>(count + o.count);
+            const double delta = o.mean - mean;
+            mean += delta * static_cast<double>(o.count) / n;
+            m2 += o.m2 + delta * delta * static_cast<double>(count) * static_cast<double>(o.count) / n;
+            count += o.count;
+            if (o.min < min) min = o.min;
+            if (o.max > max) max = o.max;
+        }
+    };
+
+    // Default: 1 s x 1 h, 1 min x 24 h, 1 h x 30 days.
+    static std::array<TierSpec, kTierCount> defaultTiers() {
+        return {{{1'000'000'000ULL, 3600}, {60'000'000'000ULL, 1440}, {3'600'000'000'000ULL, 720}}};
+    }
+
+    explicit TimingHistory(const std::array<TierSpec, kTierCount>& tiers = defaultTiers()) {
+        for (size_t i = 0; i < kTierCount; ++i) {
+            _tiers[i].spec = tiers[i];
+            if (_tiers[i].spec.resolutionNs == 0) _tiers[i].spec.resolutionNs = 1;
+            if (_tiers[i].spec.buckets == 0) _tiers[i].spec.buckets = 1;
+            _tiers[i].slots.resize(_tiers[i].spec.buckets);
+        }
+    }
+
+    // Record one value observed at timestampNs. Values older than a tier's retention, or
+    // whose slot already holds a newer bucket, are ignored by that tier.
+    void record(uint64_t timestampNs, double value) {
+        for (auto& tier : _tiers) {
+            const uint64_t epoch = timestampNs / tier.spec.resolutionNs;
+            Slot& s = tier.slots[epoch % tier.spec.buckets];
+            if (!s.valid || s.epoch < epoch) {
+                s.valid = true;
+                s.epoch = epoch;
+                s.summary = Summary{};
+            } else if (s.epoch > epoch) {
+                continue;
+            }
+            s.summary.add(value);
+            if (epoch > tier.newestEpoch || !tier.any) {
+                tier.newestEpoch = epoch;
+                tier.any = true;
+            }
+        }
+    }
+
+    // Summary over [fromNs, toNs) at bucket granularity, using the finest tier that still
+    // retains fromNs. Buckets partially overlapping the range are included whole.
+    Summary query(uint64_t fromNs, uint64_t toNs) const {
+        for (size_t i = 0; i < kTierCount; ++i) {
+            if (retains(i, fromNs)) return queryTier(i, fromNs, toNs);
+        }
+        return queryTier(kTierCount - 1, fromNs, toNs);
+    }
+
+    // Summary over [fromNs, toNs) from one tier only.
+    Summary queryTier(size_t tierIndex, uint64_t fromNs, uint64_t toNs) const {
+        Summary out;
+        if (tierIndex >= kTierCount || toNs <= fromNs) return out;
+        const Tier& tier = _tiers[tierIndex];
+        if (!tier.any) return out;
+        const uint64_t res = tier.spec.resolutionNs;
+        const uint64_t n = tier.spec.buckets;
+        uint64_t first = fromNs / res;
+        uint64_t last = (toNs - 1) / res;
+        if (last > tier.newestEpoch) last = tier.newestEpoch;
+        const uint64_t oldest = tier.newestEpoch + 1 >= n ? tier.newestEpoch + 1 - n : 0;
+        if (first < oldest) first = oldest;
+        for (uint64_t e = first; e <= last && first <= last; ++e) {
+            const Slot& s = tier.slots[e % n];
+            if (s.valid && s.epoch == e) out.merge(s.summary);
+        }
+        return out;
+    }
+
+    // True if tier still holds the bucket containing timestampNs.
+    bool retains(size_t tierIndex, uint64_t timestampNs) const {
+        const Tier& tier = _tiers[tierIndex];
+        if (!tier.any) return false;
+        const uint64_t epoch = timestampNs / tier.spec.resolutionNs;
+        return epoch + tier.spec.buckets > tier.newestEpoch;
+    }
+
+    const TierSpec& tierSpec(size_t tierIndex) const { return _tiers[tierIndex].spec; }
+
+    void clear() {
+        for (auto& tier : _tiers) {
+            for (auto& s : tier.slots) s.valid = false;
+            tier.any = false;
+            tier.newestEpoch = 0;
+        }
+    }
+
+private:
+    struct Slot {
+        uint64_t epoch{0};
+        bool valid{false};
+        Summary summary{};
+    };
+
+    struct Tier {
+        TierSpec spec{1, 1};
+        std::vector<Slot> slots;
+        uint64_t newestEpoch{0};
+        bool any{false};
+    };
+
+    std::array<Tier, kTierCount> _tiers;
+};
+
+} // namespace core
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
+
+#endif // AES_AES11_2009_CORE_TIMING_HISTORY_HPP
@@ -1,4 +1,16 @@
 #include "timing_snapshot_service.hpp"
 
-// Implementation is header-only style for now except for translation unit anchor.
-// Keeping a .cpp helps IDEs and build systems; logic resides in the header.
+// Implementation is header-only style (class template); the virtual-interface adapter is
+// instantiated here once so users of ClockInterface share a single definition.
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace core {
+
+template class TimingSnapshotService<Common::interfaces::ClockInterface>;
+
+} // namespace core
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
@@ -8,8 +8,10 @@
 #ifndef AES_AES11_2009_CORE_TIMING_SNAPSHOT_SERVICE_HPP
 #define AES_AES11_2009_CORE_TIMING_SNAPSHOT_SERVICE_HPP
 
+#include <cstddef>
 #include <cstdint>
 #include <atomic>
+#include <type_traits>
 
 #include "../../../../Common/interfaces/clock_interface.hpp"
 
@@ -27,34 +29,121 @@ struct TimingSnapshot {
     uint64_t tick;    // abstract tick counter from clock source
     uint64_t time_ns; // nanoseconds since an arbitrary epoch
     uint64_t seq;     // monotonically increasing sequence for snapshot ordering
+    uint64_t uncertainty_ticks; // tick matching time_ns lies within tick ± this bound
+};
+
+/**
+ * Total order for snapshots merged from several threads: by time, then by sequence.
+ * Each thread's own snapshots are already in this order, so per-thread streams can be
+ * combined with std::merge.
+ */
+struct TimingSnapshotOrder {
+    bool operator()(const TimingSnapshot& a, const TimingSnapshot& b) const {
+        return a.time_ns != b.time_ns ? a.time_ns < b.time_ns : a.seq < b.seq;
+    }
+};
+
+/**
+ * SequenceLease
+ * Per-thread block of sequence numbers leased from a TimingSnapshotService. Owned by
+ * exactly one thread; never shared. Refilled with one atomic add per block.
+ */
+class SequenceLease {
+public:
+    SequenceLease() = default;
+    uint64_t remaining() const { return _end - _next; }
+
+private:
+    template <typename> friend class TimingSnapshotService;
+    uint64_t _next{0};
+    uint64_t _end{0};
 };
 
 /**
  * TimingSnapshotService
  * Provides atomic snapshots of timing derived from an injected clock source.
- * - Hardware-agnostic via Common::interfaces::ClockInterface dependency.
- * - Thread-safe sequence assignment for snapshot ordering.
+ * - Hardware-agnostic: Clock is any type with get_tick() and get_time_ns() (and
+ *   optionally get_tick_time_pair() for a native paired read). With a
+ *   concrete clock (e.g., Common::clocks::MonotonicRawClock) both reads inline; the
+ *   default Clock = ClockInterface keeps the virtual-dispatch adapter path.
+ * - Thread-safe sequence assignment for snapshot ordering. snapshot() draws from one
+ *   shared counter (globally increasing); snapshot(lease) draws from a per-thread leased
+ *   block so concurrent capture threads do not contend on the counter's cache line.
+ *   Both are unique across all callers; use TimingSnapshotOrder to merge.
+ * - snapshot_batch() captures bursts into a caller-provided buffer with one sequence
+ *   reservation and batched clock reads (get_tick_time_pairs when the clock has one).
  *
  * Note: This service supports tests like TEST-TIMESRC-SNAPSHOT-001/002.
  */
+template <typename Clock = Common::interfaces::ClockInterface>
 class TimingSnapshotService {
 public:
-    explicit TimingSnapshotService(Common::interfaces::ClockInterface& clk)
-        : _clk(clk), _seq(0) {}
+    using clock_type = Clock;
+
+    static constexpr uint64_t kDefaultLeaseBlock = 256;
+    static constexpr size_t kBatchChunk = 64; // backend pairs read per batch call (stack buffer)
+
+    explicit TimingSnapshotService(Clock& clk, uint64_t leaseBlock = kDefaultLeaseBlock)
+        : _clk(clk), _seq(0), _leaseBlock(leaseBlock ? leaseBlock : 1) {}
 
     TimingSnapshot snapshot() {
-        // Read underlying clock once to ensure coherence of fields for this snapshot
-        const uint64_t tick = _clk.get_tick();
-        const uint64_t ns = _clk.get_time_ns();
+        // Paired read so preemption between tick and time cannot skew the pair; clocks
+        // without a native pair are bracketed and report the residual uncertainty.
+        const Common::interfaces::TickTimePair p = Common::interfaces::read_tick_time_pair(_clk);
         const uint64_t seq = _seq.fetch_add(1, std::memory_order_relaxed) + 1;
-        return TimingSnapshot{tick, ns, seq};
+        return TimingSnapshot{p.tick, p.time_ns, seq, p.uncertainty_ticks};
     }
 
+    // Sharded variant: sequence taken from the caller's lease (refilled when exhausted).
+    TimingSnapshot snapshot(SequenceLease& lease) {
+        const Common::interfaces::TickTimePair p = Common::interfaces::read_tick_time_pair(_clk);
+        if (lease._next == lease._end) {
+            lease._next = _seq.fetch_add(_leaseBlock, std::memory_order_relaxed) + 1;
+            lease._end = lease._next + _leaseBlock;
+        }
+        return TimingSnapshot{p.tick, p.time_ns, lease._next++, p.uncertainty_ticks};
+    }
+
+    // Burst variant (e.g., one DMA completion covering many frames): fills out[0..count)
+    // from batched backend reads and reserves the whole sequence range with one atomic add,
+    // so sequences within the batch are consecutive. Returns the number written.
+    size_t snapshot_batch(TimingSnapshot* out, size_t count) {
+        if (out == nullptr || count == 0) return 0;
+        uint64_t seq = _seq.fetch_add(count, std::memory_order_relaxed) + 1;
+        Common::interfaces::TickTimePair pairs[kBatchChunk];
+        for (size_t done = 0; done < count;) {
+            const size_t n = count - done < kBatchChunk ? count - done : kBatchChunk;
+            Common::interfaces::read_tick_time_pairs(_clk, pairs, n);
+            for (size_t i = 0; i < n; ++i) {
+                out[done + i] = TimingSnapshot{pairs[i].tick, pairs[i].time_ns, seq++, pairs[i].uncertainty_ticks};
+            }
+            done += n;
+        }
+        return count;
+    }
+
+    uint64_t leaseBlock() const { return _leaseBlock; }
+
 private:
-    Common::interfaces::ClockInterface& _clk;
+    Clock& _clk;
     std::atomic<uint64_t> _seq;
+    uint64_t _leaseBlock;
 };
 
+// Clocks derived from ClockInterface deduce the virtual adapter (existing behaviour);
+// any other clock type deduces a devirtualized service.
+template <typename C>
+using SnapshotServiceClockFor =
+    std::conditional_t<std::is_base_of<Common::interfaces::ClockInterface, C>::value,
+                       Common::interfaces::ClockInterface, C>;
+
+template <typename C>
+TimingSnapshotService(C&) -> TimingSnapshotService<SnapshotServiceClockFor<C>>;
+template <typename C>
+TimingSnapshotService(C&, uint64_t) -> TimingSnapshotService<SnapshotServiceClockFor<C>>;
+
+extern template class TimingSnapshotService<Common::interfaces::ClockInterface>;
+
 } // namespace core
 } // namespace _2009
 } // namespace AES11
@@ -0,0 +1,3 @@
+#include "trp_ingest_queue.hpp"
+
+// Implementation in header; this TU anchors the component for the build.
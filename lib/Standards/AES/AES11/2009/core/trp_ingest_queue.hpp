@@ -0,0 +1,84 @@
+// TRP Ingest Queue - DES-C-003
+// Decouples the real-time audio callback from timing analysis: the callback pushes raw
+// TRP timestamps into a wait-free SPSC ring, a worker thread drains them into
+// TimingWindowProcessor and synchronization logic. Hardware-agnostic; no allocation
+// after construction. A TRP dropped on overflow is marked in-band: the next accepted
+// timestamp carries kGapBit, so the consumer never forms an interval across the gap
+// (timestamps must stay below 2^63 ns).
+
+#ifndef AES_AES11_2009_CORE_TRP_INGEST_QUEUE_HPP
+#define AES_AES11_2009_CORE_TRP_INGEST_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../../../Common/concurrency/spsc_ring.hpp"
+#include "timing_window_processor.hpp"
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace core {
+
+class TrpIngestQueue {
+public:
+    // capacity is rounded up to the next power of two.
+    explicit TrpIngestQueue(size_t capacity) : _ring(capacity) {}
+
+    static constexpr uint64_t kGapBit = uint64_t{1} << 63;
+
+    // Producer (audio callback). Wait-free; returns false and counts a drop when full.
+    bool push(uint64_t trpTimeNs) noexcept {
+        if (_ring.try_push(_gapPending ? trpTimeNs | kGapBit : trpTimeNs)) {
+            _gapPending = false;
+            return true;
+        }
+        _gapPending = true;
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Consumer (worker thread). Passes each queued TRP timestamp to sink in order.
+    template <typename Sink>
+    size_t drain(Sink&& sink, size_t maxItems = static_cast<size_t>(-1)) {
+        return _ring.drain([&](uint64_t v) { sink(v & ~kGapBit); }, maxItems);
+    }
+
+    // Consumer (worker thread). Feeds TRP-to-TRP intervals (ns) into the window; the
+    // first timestamp after construction, resetInterval() or a dropped TRP only primes
+    // the reference.
+    size_t drain_into(TimingWindowProcessor& window, size_t maxItems = static_cast<size_t>(-1)) {
+        return _ring.drain([&](uint64_t v) {
+            const uint64_t trp = v & ~kGapBit;
+            if (_havePrev && !(v & kGapBit)) {
+                window.addSample(static_cast<double>(static_cast<int64_t>(trp - _prevTrp)));
+            }
+            _prevTrp = trp;
+            _havePrev = true;
+        }, maxItems);
+    }
+
+    // Consumer side: forget the previous TRP (e.g., after a source switch or gap).
+    void resetInterval() { _havePrev = false; }
+
+    uint64_t dropped() const { return _dropped.load(std::memory_order_relaxed); }
+    size_t pending() const { return _ring.size_approx(); }
+    size_t capacity() const { return _ring.capacity(); }
+
+private:
+    Common::concurrency::SpscRing<uint64_t> _ring;
+    // Producer-owned: written on every overflow push.
+    alignas(Common::concurrency::kCacheLineSize) std::atomic<uint64_t> _dropped{0};
+    bool _gapPending{false};
+    // Consumer-owned: written on every pop; kept off the producer's line.
+    alignas(Common::concurrency::kCacheLineSize) uint64_t _prevTrp{0};
+    bool _havePrev{false};
+};
+
+} // namespace core
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
+
+#endif // AES_AES11_2009_CORE_TRP_INGEST_QUEUE_HPP
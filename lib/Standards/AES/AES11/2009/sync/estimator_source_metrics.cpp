@@ -0,0 +1,33 @@
+#include "estimator_source_metrics.hpp"
+#include "../core/phase_tolerance.hpp"
+#include <cmath>
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace sync {
+
+SourceMetrics source_metrics_from_estimate(const core::PhaseFrequencyEstimate& est,
+                                           double sampleRateHz,
+                                           core::CaptureRange::Grade grade) {
+    using core::CaptureRange;
+    using core::PhaseTolerance;
+
+    const double absPpm = est.abs_ppm_error();
+    const double absPhaseUs = est.abs_phase_offset_us();
+    const double ppmLimit = CaptureRange::capture_limit_ppm(grade);
+    const double phaseLimitUs = PhaseTolerance::input_tolerance_us(sampleRateHz);
+
+    SourceMetrics m{};
+    m.stability = est.phaseStdDevNs / 1000.0 + std::fabs(est.driftPpmPerSec);
+    m.quality = (ppmLimit > 0.0 ? 1.0 - absPpm / ppmLimit : 0.0)
+              + (phaseLimitUs > 0.0 ? 1.0 - absPhaseUs / phaseLimitUs : 0.0);
+    m.degraded = !CaptureRange::within_capture(absPpm, grade)
+              || !PhaseTolerance::within_input(sampleRateHz, absPhaseUs);
+    return m;
+}
+
+} // namespace sync
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
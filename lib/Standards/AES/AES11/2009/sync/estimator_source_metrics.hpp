@@ -0,0 +1,38 @@
+/*
+ * Original implementation based on understanding of AES-11-2009 Sections 5.2
+ * (capture range) and 5.3 (phase tolerances). No copyrighted text is reproduced.
+ */
+
+#ifndef AES_AES11_2009_SYNC_ESTIMATOR_SOURCE_METRICS_HPP
+#define AES_AES11_2009_SYNC_ESTIMATOR_SOURCE_METRICS_HPP
+
+#include "synchronization_manager.hpp"
+#include "../core/capture_range.hpp"
+#include "../core/phase_frequency_estimator.hpp"
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace sync {
+
+/**
+ * @brief Map a phase/frequency estimate onto SynchronizationManager inputs
+ *
+ * - stability: phase 1-sigma (µs) plus |drift| (ppm/s); lower is better.
+ * - quality: remaining capture-range margin plus remaining input phase margin,
+ *   each normalised to 1.0 at zero error; higher is better.
+ * - degraded: outside capture range (CaptureRange::within_capture) or outside
+ *   input phase tolerance (PhaseTolerance::within_input).
+ *
+ * @note Relates to REQ-F-DARS-003 (capture range) and REQ-F-DARS-004 (phase tolerance).
+ */
+SourceMetrics source_metrics_from_estimate(const core::PhaseFrequencyEstimate& est,
+                                           double sampleRateHz,
+                                           core::CaptureRange::Grade grade);
+
+} // namespace sync
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
+
+#endif // AES_AES11_2009_SYNC_ESTIMATOR_SOURCE_METRICS_HPP
@@ -1,5 +1,8 @@
 #include "gps_reference_sync.hpp"
+#include "../../../../Common/math/int128.hpp"
+#include <climits>
 #include <cmath>
+#include <cstring>
 
 namespace AES {
 namespace AES11 {
@@ -17,6 +20,126 @@ bool GPSReferenceSync::within_alignment(uint64_t trpTimeNs, uint64_t ppsTimeNs,
     return phase_offset_us(trpTimeNs, ppsTimeNs) <= tolerance_us; // REQ-F-DARS-006 ±1 µs default
 }
 
+namespace {
+
+constexpr size_t kChunk = 64; // one bitmap word
+constexpr int64_t kSmall = int64_t{1} << 28;
+
+// Pack 64 flag bytes (0/1) into a word, bit j = flag j: each multiply gathers 8 bytes
+// into the top byte (byte k of x lands on bit k; partial sums never carry).
+uint64_t packFlags(const uint8_t* flags) {
+    uint64_t word = 0;
+    for (size_t k = 0; k < kChunk; k += 8) {
+        uint64_t x;
+        std::memcpy(&x, flags + k, sizeof(x));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        uint64_t bits = 0;
+        for (size_t b = 0; b < 8; ++b) bits |= static_cast<uint64_t>(flags[k + b]) << b;
+        word |= bits << k;
+#else
+        word |= ((x * 0x0102040810204080ULL) >> 56) << k;
+#endif
+    }
+    return word;
+}
+
+struct ChunkStats {
+    size_t pass;
+    uint64_t maxAbs;
+    Common::math::Int128 sum;
+    Common::math::Int128 sumSq;
+};
+
+// |offsets| < 2^28: 32-bit lanes throughout (SSE2 lacks 64-bit compares and arithmetic
+// shifts), squares as 32x32->64 products; 64-bit sums are exact (64 * 2^56 < 2^63).
+ChunkStats smallChunk(const int64_t* d, size_t n, uint64_t toleranceNs, uint8_t* ok) {
+    int32_t v[kChunk];
+    int32_t a[kChunk];
+    const int32_t tol = toleranceNs >= static_cast<uint64_t>(kSmall) ? INT32_MAX : static_cast<int32_t>(toleranceNs);
+    for (size_t j = 0; j < n; ++j) v[j] = static_cast<int32_t>(d[j]);
+    for (size_t j = 0; j < n; ++j) {
+        const int32_t m = v[j] >> 31;
+        a[j] = (v[j] ^ m) - m;
+    }
+    for (size_t j = 0; j < n; ++j) ok[j] = a[j] <= tol ? 1 : 0;
+    int64_t sum = 0;
+    uint64_t sq = 0;
+    int32_t mx = 0;
+    size_t pass = 0;
+    for (size_t j = 0; j < n; ++j) {
+        sum += v[j];
+        sq += static_cast<uint64_t>(static_cast<uint32_t>(a[j])) * static_cast<uint32_t>(a[j]);
+        mx = a[j] > mx ? a[j] : mx;
+        pass += ok[j];
+    }
+    return ChunkStats{pass, static_cast<uint64_t>(mx), Common::math::Int128(sum), Common::math::Int128(0, sq)};
+}
+
+// Any offset: 64-bit magnitudes and exact 128-bit squares.
+ChunkStats largeChunk(const int64_t* d, size_t n, uint64_t toleranceNs, uint8_t* ok) {
+    ChunkStats c{0, 0, Common::math::Int128{}, Common::math::Int128{}};
+    for (size_t j = 0; j < n; ++j) {
+        const uint64_t a = d[j] < 0 ? 0 - static_cast<uint64_t>(d[j]) : static_cast<uint64_t>(d[j]);
+        ok[j] = a <= toleranceNs ? 1 : 0;
+        c.pass += ok[j];
+        c.sum += Common::math::Int128(d[j]);
+        c.maxAbs = a > c.maxAbs ? a : c.maxAbs;
+        c.sumSq += Common::math::Int128::mul(d[j], d[j]);
+    }
+    return c;
+}
+
+uint64_t absOffset(int64_t d) { return d < 0 ? 0 - static_cast<uint64_t>(d) : static_cast<uint64_t>(d); }
+
+} // namespace
+
+// Chunks of 64 pairs: offsets are computed once into a local array, a range check picks
+// the 32-bit lane kernel (the normal case for alignment data) or the exact 64/128-bit
+// one, and 128-bit totals are updated once per chunk. Each kernel is a set of short
+// branch-free loops the compiler vectorizes.
+GPSReferenceSync::AlignmentStats GPSReferenceSync::evaluate_alignment(const uint64_t* trpTimeNs,
+                                                                      const uint64_t* ppsTimeNs, size_t count,
+                                                                      uint64_t toleranceNs, uint64_t* passBitmap) {
+    using Common::math::Int128;
+    AlignmentStats st{};
+    st.count = count;
+    Int128 sum{};
+    Int128 sumSq{};
+    int64_t d[kChunk];
+    uint8_t ok[kChunk];
+    for (size_t base = 0; base < count; base += kChunk) {
+        const size_t n = count - base < kChunk ? count - base : kChunk;
+        const uint64_t* trp = trpTimeNs + base;
+        const uint64_t* pps = ppsTimeNs + base;
+        uint64_t outside = 0; // non-zero if some offset is outside [-2^28, 2^28)
+        for (size_t j = 0; j < n; ++j) {
+            d[j] = static_cast<int64_t>(trp[j] - pps[j]);
+            outside |= (static_cast<uint64_t>(d[j]) + static_cast<uint64_t>(kSmall)) >> 29;
+        }
+        const ChunkStats c = outside == 0 ? smallChunk(d, n, toleranceNs, ok) : largeChunk(d, n, toleranceNs, ok);
+        if (passBitmap) {
+            for (size_t j = n; j < kChunk; ++j) ok[j] = 0;
+            passBitmap[base / kChunk] = packFlags(ok);
+        }
+        st.passCount += c.pass;
+        sum += c.sum;
+        sumSq += c.sumSq;
+        if (c.maxAbs > st.worstOffsetNs) {
+            // First pair with the new worst offset (rare once the worst has settled).
+            size_t j = 0;
+            while (absOffset(d[j]) != c.maxAbs) ++j;
+            st.worstIndex = base + j;
+            st.worstOffsetNs = c.maxAbs;
+        }
+    }
+    if (count > 0) {
+        const double n = static_cast<double>(count);
+        st.meanOffsetNs = sum.to_double() / n;
+        st.rmsOffsetNs = std::sqrt(sumSq.to_double() / n);
+    }
+    return st;
+}
+
 } // namespace sync
 } // namespace _2009
 } // namespace AES11
@@ -6,6 +6,7 @@
 #ifndef AES_AES11_2009_SYNC_GPS_REFERENCE_SYNC_HPP
 #define AES_AES11_2009_SYNC_GPS_REFERENCE_SYNC_HPP
 
+#include <cstddef>
 #include <cstdint>
 
 namespace AES {
@@ -29,6 +30,8 @@ public:
      * @param trpTimeNs Timestamp of DARS TRP in nanoseconds
      * @param ppsTimeNs Timestamp of GPS 1PPS rising edge in nanoseconds
      * @return |trpTimeNs - ppsTimeNs| converted to microseconds (double)
+     * @note Not reduced modulo the frame period; use core::FramePhase::offset for the
+     *       signed offset from the nearest frame boundary.
      */
     static double phase_offset_us(uint64_t trpTimeNs, uint64_t ppsTimeNs);
 
@@ -37,6 +40,35 @@ public:
      * Defaults to ±1 µs per requirement.
      */
     static bool within_alignment(uint64_t trpTimeNs, uint64_t ppsTimeNs, double tolerance_us = 1.0);
+
+    /**
+     * @brief Aggregate result of evaluate_alignment() over a batch of TRP/PPS pairs
+     *
+     * Offsets are signed trp - pps in integer ns; mean and RMS are derived from exact
+     * 128-bit sums and only rounded on conversion.
+     */
+    struct AlignmentStats {
+        size_t count{0};
+        size_t passCount{0};         // |offset| <= tolerance
+        uint64_t worstOffsetNs{0};   // largest |offset|
+        size_t worstIndex{0};        // first pair with that offset
+        double meanOffsetNs{0.0};    // signed
+        double rmsOffsetNs{0.0};
+
+        bool all_pass() const { return passCount == count; }
+    };
+
+    /**
+     * @brief Evaluate count TRP/PPS pairs in one pass (integer ns, no per-pair division)
+     * @param trpTimeNs,ppsTimeNs Parallel arrays of timestamps
+     * @param toleranceNs Pass if |trp - pps| <= toleranceNs (1000 matches within_alignment())
+     * @param passBitmap Optional output of (count + 63) / 64 words; bit i of word i / 64
+     *                   is set when pair i passes (unused high bits of the last word are 0)
+     *
+     * Offsets must stay below 2^62 ns in magnitude.
+     */
+    static AlignmentStats evaluate_alignment(const uint64_t* trpTimeNs, const uint64_t* ppsTimeNs, size_t count,
+                                             uint64_t toleranceNs = 1000, uint64_t* passBitmap = nullptr);
 };
 
 } // namespace sync
@@ -0,0 +1,3 @@
+#include "pps_servo.hpp"
+
+// Implementation in header; this TU anchors the component for the build.
@@ -0,0 +1,194 @@
+/*
+ * Original implementation based on understanding of AES-11-2009 Section 4.2.4
+ * (GPS-referenced synchronization). No copyrighted text is reproduced.
+ */
+
+#ifndef AES_AES11_2009_SYNC_PPS_SERVO_HPP
+#define AES_AES11_2009_SYNC_PPS_SERVO_HPP
+
+#include <cstdint>
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace sync {
+
+/**
+ * @brief Streaming PI servo disciplining a DARS timebase to GPS 1PPS
+ *
+ * Consumes one (TRP, PPS) timestamp pair per PPS edge. The phase error is the signed
+ * TRP - PPS in ns (positive: the local TRP is late, i.e. the local clock is slow). Output
+ * per pair:
+ * - phaseCorrectionNs: non-zero only on a step (-error; add to the local phase);
+ * - frequencyCorrectionPpb: feedForward + kp * error + integral, to add to the local
+ *   rate (ns/s == ppb). The integral term is clamped to ±maxFrequencyPpb (anti-windup).
+ *
+ * States: Unlocked until the second pair, which seeds the integral from the phase slope
+ * and steps if the error exceeds stepThresholdNs; Acquiring until lockSamples
+ * consecutive errors lie within lockThresholdNs; Locked until an error exceeds
+ * unlockThresholdNs (one beyond stepThresholdNs is an outlier: frequency held, integral
+ * untouched, no step); Holdover when check_holdover() sees no pair for holdoverTimeoutNs,
+ * keeping the last integral plus feed-forward. After holdover the servo re-acquires.
+ *
+ * All state is scalar (trivially copyable, no allocation), so arrays of servos can run
+ * per PPS tick for many receivers in one thread.
+ *
+ * @note Implements tracking aspects of REQ-F-DARS-006 (GPS-Referenced Synchronization).
+ */
+class PpsServo {
+public:
+    enum class State : uint8_t { Unlocked, Acquiring, Locked, Holdover };
+
+    struct Config {
+        double kp = 0.7;                       // ppb per ns of phase error
+        double ki = 0.3;                       // ppb per ns per second
+        double maxFrequencyPpb = 100'000.0;    // ±100 ppm
+        int64_t stepThresholdNs = 20'000;      // larger errors are stepped, not slewed
+        int64_t lockThresholdNs = 1'000;       // ±1 µs alignment goal
+        int64_t unlockThresholdNs = 5'000;
+        uint32_t lockSamples = 4;
+        uint64_t holdoverTimeoutNs = 3'000'000'000ULL;
+    };
+
+    struct Output {
+        State state;
+        int64_t phaseErrorNs;
+        int64_t phaseCorrectionNs;
+        double frequencyCorrectionPpb;
+    };
+
+    PpsServo() : PpsServo(Config{}) {}
+    explicit PpsServo(const Config& cfg) : _cfg(cfg) {}
+
+    // Frequency feed-forward in ppb (e.g., from a PhaseFrequencyEstimator); 0 disables.
+    void set_feed_forward(double ppb) { _feedForwardPpb = ppb; }
+
+    Output update(uint64_t trpNs, uint64_t ppsNs) {
+        const int64_t err = static_cast<int64_t>(trpNs - ppsNs);
+        Output out{_state, err, 0, frequency(0.0)};
+        if (!_havePrev) {
+            _havePrev = true;
+            remember(err, ppsNs);
+            _lastOutputPpb = out.frequencyCorrectionPpb;
+            return out;
+        }
+        const double dt = ppsNs > _lastPpsNs ? static_cast<double>(ppsNs - _lastPpsNs) * 1e-9 : 0.0;
+
+        if (_state == State::Unlocked) {
+            // Seed the integral with the observed slope (ns/s = ppb) net of feed-forward.
+            if (dt > 0.0) _integralPpb = clamp(static_cast<double>(err - _lastErrNs) / dt + _lastOutputPpb - _feedForwardPpb);
+            _state = State::Acquiring;
+            _goodSamples = 0;
+            if (abs64(err) > _cfg.stepThresholdNs) {
+                step(out, err);
+            } else {
+                out.frequencyCorrectionPpb = frequency(static_cast<double>(err));
+            }
+        } else if (abs64(err) > _cfg.stepThresholdNs) {
+            if (_state == State::Locked) {
+                // One outlier must not step a locked loop or wind up the integral: hold
+                // frequency and re-acquire; a persistent error steps on the next pair.
+                _state = State::Acquiring;
+                _goodSamples = 0;
+            } else {
+                step(out, err);
+            }
+        } else {
+            // The first pair after holdover spans the gap: do not integrate over it.
+            const double span = _state == State::Holdover ? 0.0 : dt;
+            _integralPpb = clamp(_integralPpb + _cfg.ki * static_cast<double>(err) * span);
+            out.frequencyCorrectionPpb = frequency(static_cast<double>(err));
+            trackLock(err);
+        }
+        out.state = _state;
+        remember(out.phaseCorrectionNs ? 0 : err, ppsNs);
+        _lastOutputPpb = out.frequencyCorrectionPpb;
+        return out;
+    }
+
+    // Call periodically (e.g., on each expected PPS); enters Holdover when no pair arrived
+    // for holdoverTimeoutNs. Returns the current state.
+    State check_holdover(uint64_t nowNs) {
+        if ((_state == State::Acquiring || _state == State::Locked) && nowNs > _lastPpsNs &&
+            nowNs - _lastPpsNs > _cfg.holdoverTimeoutNs) {
+            _state = State::Holdover;
+            _goodSamples = 0;
+            _lastOutputPpb = frequency(0.0);
+        }
+        return _state;
+    }
+
+    // Frequency correction to apply while no pairs arrive (integral plus feed-forward).
+    double holdover_frequency_ppb() const { return frequency(0.0); }
+
+    State state() const { return _state; }
+    bool locked() const { return _state == State::Locked; }
+    double integral_ppb() const { return _integralPpb; }
+    uint64_t steps() const { return _steps; }
+
+    void reset() {
+        _state = State::Unlocked;
+        _havePrev = false;
+        _integralPpb = 0.0;
+        _lastOutputPpb = 0.0;
+        _goodSamples = 0;
+        _steps = 0;
+    }
+
+private:
+    static int64_t abs64(int64_t v) { return v < 0 ? -v : v; }
+
+    double clamp(double ppb) const {
+        if (ppb > _cfg.maxFrequencyPpb) return _cfg.maxFrequencyPpb;
+        if (ppb < -_cfg.maxFrequencyPpb) return -_cfg.maxFrequencyPpb;
+        return ppb;
+    }
+
+    double frequency(double errNs) const { return clamp(_feedForwardPpb + _cfg.kp * errNs + _integralPpb); }
+
+    void step(Output& out, int64_t err) {
+        out.phaseCorrectionNs = -err;
+        out.frequencyCorrectionPpb = frequency(0.0);
+        _state = State::Acquiring;
+        _goodSamples = 0;
+        ++_steps;
+    }
+
+    void trackLock(int64_t err) {
+        const int64_t a = abs64(err);
+        if (_state == State::Locked) {
+            if (a > _cfg.unlockThresholdNs) {
+                _state = State::Acquiring;
+                _goodSamples = 0;
+            }
+            return;
+        }
+        // Acquiring, or the first pair after holdover.
+        _state = State::Acquiring;
+        _goodSamples = a <= _cfg.lockThresholdNs ? _goodSamples + 1 : 0;
+        if (_goodSamples >= _cfg.lockSamples) _state = State::Locked;
+    }
+
+    void remember(int64_t err, uint64_t ppsNs) {
+        _lastErrNs = err;
+        _lastPpsNs = ppsNs;
+    }
+
+    Config _cfg;
+    State _state{State::Unlocked};
+    bool _havePrev{false};
+    int64_t _lastErrNs{0};
+    uint64_t _lastPpsNs{0};
+    double _integralPpb{0.0};
+    double _feedForwardPpb{0.0};
+    double _lastOutputPpb{0.0};
+    uint32_t _goodSamples{0};
+    uint64_t _steps{0};
+};
+
+} // namespace sync
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
+
+#endif // AES_AES11_2009_SYNC_PPS_SERVO_HPP
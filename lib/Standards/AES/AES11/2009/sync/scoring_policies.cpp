@@ -0,0 +1,3 @@
+#include "scoring_policies.hpp"
+
+// Implementation in header; this TU anchors the component for the build.
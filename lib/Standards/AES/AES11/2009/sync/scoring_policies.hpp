@@ -0,0 +1,108 @@
+/*
+ * Original implementation based on understanding of AES-11-2009 Sections 5.1.3
+ * (DARS grade in channel status) and 5.2 (capture range). No copyrighted text is
+ * reproduced.
+ */
+
+#ifndef AES_AES11_2009_SYNC_SCORING_POLICIES_HPP
+#define AES_AES11_2009_SYNC_SCORING_POLICIES_HPP
+
+#include <cmath>
+
+#include "synchronization_manager.hpp"
+#include "../core/capture_range.hpp"
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace sync {
+
+/**
+ * @brief Wander-weighted scoring: MTIE replaces the short-term stability term
+ *
+ * score = quality - mtieNs / nsPerPoint, minus degradedPenalty when degraded.
+ *
+ * @note Relates to REQ-F-SYNC-001 (reference selection).
+ */
+struct MtieScoringPolicy {
+    using metrics_type = ExtendedSourceMetrics;
+
+    double nsPerPoint = 100.0;     // MTIE that costs one quality point
+    double degradedPenalty = 10.0;
+
+    double operator()(const ExtendedSourceMetrics& m) const {
+        double s = m.quality - m.mtieNs / nsPerPoint;
+        if (m.degraded) s -= degradedPenalty;
+        return s;
+    }
+};
+
+/**
+ * @brief Frequency-error scoring against the capture range of a DARS grade
+ *
+ * score = quality - stability - weight * |ppmError| / captureLimit, with an extra
+ * outsideCapturePenalty beyond the limit (CaptureRange::capture_limit_ppm) and
+ * degradedPenalty when degraded. The limit is resolved once at construction.
+ *
+ * @note Relates to REQ-F-DARS-003 (capture range) and REQ-F-SYNC-001.
+ */
+struct PpmErrorScoringPolicy {
+    using metrics_type = ExtendedSourceMetrics;
+
+    explicit PpmErrorScoringPolicy(core::CaptureRange::Grade grade = core::CaptureRange::Grade::Grade1,
+                                   double weightPoints = 1.0)
+        : captureLimitPpm(core::CaptureRange::capture_limit_ppm(grade)), weight(weightPoints) {}
+
+    double captureLimitPpm;
+    double weight;
+    double outsideCapturePenalty = 10.0;
+    double degradedPenalty = 10.0;
+
+    double operator()(const ExtendedSourceMetrics& m) const {
+        const double absPpm = std::fabs(m.ppmError);
+        double s = m.quality - m.stability - weight * (captureLimitPpm > 0.0 ? absPpm / captureLimitPpm : absPpm);
+        if (absPpm > captureLimitPpm) s -= outsideCapturePenalty;
+        if (m.degraded) s -= degradedPenalty;
+        return s;
+    }
+};
+
+/**
+ * @brief Channel-status grade scoring: prefer references advertising Grade 1
+ *
+ * Default score plus a bonus per advertised DARS grade (channel status byte 4);
+ * the reserved code is treated like a degraded source.
+ *
+ * @note Relates to REQ-F-DARS-002 (Grade 1/2) and REQ-F-SYNC-001.
+ */
+struct ChannelStatusGradeScoringPolicy {
+    using metrics_type = ExtendedSourceMetrics;
+
+    double grade1Bonus = 1.0;
+    double grade2Bonus = 0.5;
+    double unknownBonus = 0.0;
+    double degradedPenalty = 10.0;
+
+    double operator()(const ExtendedSourceMetrics& m) const {
+        double s = m.quality - m.stability;
+        switch (m.grade) {
+            case core::DARSGrade::Grade1: s += grade1Bonus; break;
+            case core::DARSGrade::Grade2: s += grade2Bonus; break;
+            case core::DARSGrade::Unknown: s += unknownBonus; break;
+            default: s -= degradedPenalty; break;
+        }
+        if (m.degraded) s -= degradedPenalty;
+        return s;
+    }
+};
+
+using MtieSynchronizationManager = BasicSynchronizationManager<MtieScoringPolicy>;
+using PpmErrorSynchronizationManager = BasicSynchronizationManager<PpmErrorScoringPolicy>;
+using GradeSynchronizationManager = BasicSynchronizationManager<ChannelStatusGradeScoringPolicy>;
+
+} // namespace sync
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
+
+#endif // AES_AES11_2009_SYNC_SCORING_POLICIES_HPP
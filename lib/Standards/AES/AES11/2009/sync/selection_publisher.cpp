@@ -0,0 +1,22 @@
+#include "selection_publisher.hpp"
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace sync {
+
+void SelectionPublisher::publish(size_t reference, const SourceMetrics& metrics, double score) {
+    const SelectionSnapshot& prev = _publisher.current();
+    SelectionSnapshot next;
+    next.reference = reference;
+    next.metrics = metrics;
+    next.score = score;
+    next.sequence = prev.sequence + 1;
+    next.switches = prev.switches + (prev.sequence != 0 && prev.reference != reference ? 1 : 0);
+    _publisher.publish(next);
+}
+
+} // namespace sync
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
@@ -0,0 +1,101 @@
+/*
+ * Original implementation based on understanding of AES-11-2009 Section 4.2
+ * (reference selection for synchronization). No copyrighted text is reproduced.
+ */
+
+#ifndef AES_AES11_2009_SYNC_SELECTION_PUBLISHER_HPP
+#define AES_AES11_2009_SYNC_SELECTION_PUBLISHER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "../../../../Common/concurrency/epoch_publisher.hpp"
+#include "synchronization_manager.hpp"
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace sync {
+
+/**
+ * @brief Immutable view of one selection decision
+ */
+struct SelectionSnapshot {
+    size_t reference = std::numeric_limits<size_t>::max(); // invalidIndex() when none
+    SourceMetrics metrics{0.0, 0.0, false};                 // metrics of the reference
+    double score = 0.0;                                     // policy score of the reference
+    uint64_t sequence = 0;                                  // publications so far
+    uint64_t switches = 0;                                  // reference changes so far
+};
+
+/**
+ * @brief Lock-free hand-off of the selected reference from the control thread to
+ *        audio threads
+ *
+ * The control thread owns the SynchronizationManager (which is not thread-safe) and
+ * publishes after each reselection; every audio thread registers one Reader and reads
+ * the snapshot in its callback without locking. Snapshots are swapped in with an atomic
+ * pointer exchange and reclaimed by epoch (Common::concurrency::EpochPublisher), so a
+ * reader holding a Guard always sees a complete, consistent snapshot.
+ *
+ * @note Publishing allocates one snapshot (control thread only); reading never does.
+ *       Supports REQ-NF-PERF-001 and REQ-F-SYNC-001.
+ */
+class SelectionPublisher {
+public:
+    static constexpr size_t kMaxReaders = 16;
+    using Publisher = Common::concurrency::EpochPublisher<SelectionSnapshot, kMaxReaders>;
+    using Reader = Publisher::Reader;
+    using Guard = Publisher::Guard;
+
+    SelectionPublisher() = default;
+
+    // Any thread; Reader::valid() is false once kMaxReaders readers are registered.
+    Reader register_reader() const { return _publisher.register_reader(); }
+
+    // Control thread: publish an explicit decision.
+    void publish(size_t reference, const SourceMetrics& metrics, double score);
+
+    // Control thread: run select() and publish its result.
+    template <typename Manager>
+    size_t publish_select(Manager& manager, const std::vector<typename Manager::metrics_type>& sources) {
+        const size_t ref = manager.select(sources);
+        if (ref < sources.size()) {
+            publish(ref, sources[ref], manager.policy()(sources[ref]));
+        } else {
+            publish(ref, SourceMetrics{0.0, 0.0, false}, 0.0);
+        }
+        return ref;
+    }
+
+    // Control thread: run best() on the incremental path and publish its result.
+    template <typename Manager>
+    size_t publish_best(Manager& manager) {
+        const size_t ref = manager.best();
+        if (ref < manager.source_count()) {
+            const typename Manager::metrics_type& m = manager.source_metrics(ref);
+            publish(ref, m, manager.policy()(m));
+        } else {
+            publish(ref, SourceMetrics{0.0, 0.0, false}, 0.0);
+        }
+        return ref;
+    }
+
+    // Control thread: last published snapshot.
+    const SelectionSnapshot& current() const { return _publisher.current(); }
+
+    // Control thread: snapshots awaiting reclamation (readers still inside a Guard).
+    size_t retired() const { return _publisher.retired(); }
+
+private:
+    Publisher _publisher;
+};
+
+} // namespace sync
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
+
+#endif // AES_AES11_2009_SYNC_SELECTION_PUBLISHER_HPP
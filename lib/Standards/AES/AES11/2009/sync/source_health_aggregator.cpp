@@ -0,0 +1,94 @@
+#include "source_health_aggregator.hpp"
+#include "../core/phase_tolerance.hpp"
+#include <cmath>
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace sync {
+
+SourceHealthAggregator::SourceHealthAggregator(const Config& cfg)
+    : _cfg(cfg),
+      _phaseLimitUs(core::PhaseTolerance::input_tolerance_us(static_cast<double>(cfg.nominalSampleRateHz))) {}
+
+SourceHealthAggregator::Source& SourceHealthAggregator::source(size_t id) {
+    while (_sources.size() <= id) {
+        _sources.push_back(Source{core::IntegerTimingWindowProcessor(_cfg.windowCapacity, _cfg.varianceThresholdNs2),
+                                  core::SampleRateValidator::ValidationCategory::Fail, 0, false, false, false,
+                                  false, false, ExtendedSourceMetrics{}, ExtendedSourceMetrics{}});
+    }
+    return _sources[id];
+}
+
+void SourceHealthAggregator::add_phase_sample(size_t id, int64_t phaseOffsetNs) {
+    Source& s = source(id);
+    s.window.addSample(phaseOffsetNs);
+    s.lastPhaseNs = phaseOffsetNs;
+    s.havePhase = true;
+    refresh(id);
+}
+
+void SourceHealthAggregator::add_rate_measurement(size_t id, double measuredHz) {
+    Source& s = source(id);
+    const double nominal = static_cast<double>(_cfg.nominalSampleRateHz);
+    s.rateClass = core::SampleRateValidator::classify(_cfg.nominalSampleRateHz, measuredHz);
+    s.current.ppmError = nominal > 0.0 ? (measuredHz - nominal) / nominal * 1e6 : 0.0;
+    s.haveRate = true;
+    refresh(id);
+}
+
+void SourceHealthAggregator::set_grade(size_t id, core::DARSGrade grade) {
+    source(id).current.grade = grade;
+    refresh(id);
+}
+
+void SourceHealthAggregator::remove_source(size_t id) {
+    if (id >= _sources.size()) return;
+    Source& s = _sources[id];
+    s.window.clear();
+    s.haveRate = s.havePhase = false;
+    s.current = ExtendedSourceMetrics{};
+    s.removed = true;
+    if (s.published && !s.queued) {
+        s.queued = true;
+        _queue.push_back(id);
+    }
+}
+
+// Recompute one source's metrics (O(1)) and queue it if the change matters.
+void SourceHealthAggregator::refresh(size_t id) {
+    using Category = core::SampleRateValidator::ValidationCategory;
+    Source& s = _sources[id];
+    s.removed = false;
+    const core::TimingWindowProcessor::Metrics w = s.window.metrics();
+
+    double rateScore = 0.0;
+    if (s.haveRate) rateScore = s.rateClass == Category::Pass ? 1.0 : (s.rateClass == Category::Warning ? 0.5 : 0.0);
+    const double absPhaseUs = s.havePhase ? std::fabs(static_cast<double>(s.lastPhaseNs)) / 1000.0 : 0.0;
+    const double phaseMargin = _phaseLimitUs > 0.0 ? 1.0 - absPhaseUs / _phaseLimitUs : 0.0;
+
+    s.current.stability = w.count ? std::sqrt(w.variance) / 1000.0 : 0.0;
+    s.current.quality = rateScore + (phaseMargin > 0.0 ? phaseMargin : 0.0);
+    s.current.degraded = (s.haveRate && s.rateClass == Category::Fail) ||
+                         (s.havePhase && absPhaseUs > _phaseLimitUs) ||
+                         (w.count >= _cfg.minSamplesForStability && !w.stable);
+
+    if (!s.queued && (!s.published || significant(s))) {
+        s.queued = true;
+        _queue.push_back(id);
+    }
+}
+
+bool SourceHealthAggregator::significant(const Source& s) const {
+    const ExtendedSourceMetrics& a = s.current;
+    const ExtendedSourceMetrics& b = s.pushed;
+    return a.degraded != b.degraded || a.grade != b.grade ||
+           std::fabs(a.stability - b.stability) > _cfg.stabilityDeadband ||
+           std::fabs(a.quality - b.quality) > _cfg.qualityDeadband ||
+           std::fabs(a.ppmError - b.ppmError) > _cfg.ppmDeadband;
+}
+
+} // namespace sync
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
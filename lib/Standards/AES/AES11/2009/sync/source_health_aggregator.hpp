@@ -0,0 +1,127 @@
+/*
+ * Original implementation based on understanding of AES-11-2009 Sections 5.1.6
+ * (sampling frequency), 5.3 (phase tolerances) and 4.2 (reference selection). No
+ * copyrighted text is reproduced.
+ */
+
+#ifndef AES_AES11_2009_SYNC_SOURCE_HEALTH_AGGREGATOR_HPP
+#define AES_AES11_2009_SYNC_SOURCE_HEALTH_AGGREGATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../core/channel_status_utils.hpp"
+#include "../core/integer_timing_window.hpp"
+#include "../core/sample_rate_validation.hpp"
+#include "synchronization_manager.hpp"
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace sync {
+
+/**
+ * @brief Per-source health state feeding SynchronizationManager incrementally
+ *
+ * Owns, per source, a core::IntegerTimingWindowProcessor over TRP phase offsets (O(1)
+ * per sample), the latest SampleRateValidator classification and the latest phase
+ * check against PhaseTolerance::input_tolerance_us. Each input recomputes that source's
+ * ExtendedSourceMetrics in O(1) (a default-policy manager receives the SourceMetrics part):
+ * - stability: phase-offset standard deviation in µs;
+ * - quality: rate score (Pass 1.0, Warning 0.5, Fail or no measurement 0.0) plus the
+ *   remaining input phase margin (1.0 at zero offset, 0.0 at the tolerance);
+ * - degraded: rate Fail, latest phase outside tolerance, or a window of at least
+ *   minSamplesForStability samples whose variance is above the threshold;
+ * - ppmError (signed) and grade, for scoring policies that use them.
+ *
+ * A source whose metrics moved by more than the deadbands (or whose degraded flag or
+ * grade changed) is queued once; push_changes() hands only the queued sources to
+ * update_source(), so a selection pass costs O(changed * log n) rather than O(n). A
+ * change that knocks sources out of the manager's ranked backup list can add one
+ * O(k log n) refill (k = backup depth); no pass rescans all n sources.
+ *
+ * @note Relates to REQ-F-SYNC-001, REQ-F-DARS-004 and REQ-F-DARS-008.
+ */
+class SourceHealthAggregator {
+public:
+    struct Config {
+        uint32_t nominalSampleRateHz = 48000;
+        size_t windowCapacity = 32;
+        double varianceThresholdNs2 = 1.0e4;
+        size_t minSamplesForStability = 2;
+        double stabilityDeadband = 0.0; // µs; changes at or below are not pushed
+        double qualityDeadband = 0.0;
+        double ppmDeadband = 0.0;
+    };
+
+    explicit SourceHealthAggregator(const Config& cfg);
+
+    // Ids need not be contiguous; storage grows to the largest id seen.
+    void add_phase_sample(size_t id, int64_t phaseOffsetNs);
+    void add_rate_measurement(size_t id, double measuredHz);
+    void set_grade(size_t id, core::DARSGrade grade);
+
+    // Forget the source's history and withdraw it from the manager at the next push.
+    void remove_source(size_t id);
+
+    // Push queued sources (update_source / remove_source) and return how many were pushed.
+    template <typename Manager>
+    size_t push_changes(Manager& manager) {
+        const size_t n = _queue.size();
+        for (size_t id : _queue) {
+            Source& s = _sources[id];
+            s.queued = false;
+            if (s.removed) {
+                manager.remove_source(id);
+                s.published = false;
+                continue;
+            }
+            manager.update_source(id, s.current);
+            s.pushed = s.current;
+            s.published = true;
+        }
+        _queue.clear();
+        _pushes += n;
+        return n;
+    }
+
+    // Current derived metrics for id (whether or not pushed yet).
+    const ExtendedSourceMetrics& metrics(size_t id) const { return _sources[id].current; }
+    core::TimingWindowProcessor::Metrics window_metrics(size_t id) const { return _sources[id].window.metrics(); }
+
+    size_t source_count() const { return _sources.size(); }
+    size_t pending() const { return _queue.size(); }
+    uint64_t pushes() const { return _pushes; }
+
+private:
+    struct Source {
+        core::IntegerTimingWindowProcessor window;
+        core::SampleRateValidator::ValidationCategory rateClass;
+        int64_t lastPhaseNs;
+        bool haveRate;
+        bool havePhase;
+        bool removed;
+        bool queued;
+        bool published; // manager holds pushed
+        ExtendedSourceMetrics current;
+        ExtendedSourceMetrics pushed;
+    };
+
+    Source& source(size_t id);
+    void refresh(size_t id);
+    bool significant(const Source& s) const;
+
+    Config _cfg;
+    double _phaseLimitUs;
+    std::vector<Source> _sources;
+    std::vector<size_t> _queue;
+    uint64_t _pushes{0};
+};
+
+} // namespace sync
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
+
+#endif // AES_AES11_2009_SYNC_SOURCE_HEALTH_AGGREGATOR_HPP
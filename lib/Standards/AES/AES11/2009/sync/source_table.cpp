@@ -0,0 +1,97 @@
+#include "source_table.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace sync {
+
+namespace {
+
+constexpr size_t kWord = 64;  // one degraded-mask word
+constexpr size_t kLanes = 8;  // independent running maxima (vector width x unroll)
+constexpr double kPenalty = DefaultScoringPolicy::kDegradedPenalty;
+
+// GCC -O3 fully unrolls the kLanes loop before vectorizing it, leaving scalar code; keep it
+// rolled so it becomes packed subtract/max.
+#if defined(__GNUC__) && !defined(__clang__)
+#define AES11_LANE_LOOP _Pragma("GCC unroll 1")
+#else
+#define AES11_LANE_LOOP
+#endif
+
+// Maximum score over one 64-entry word. Each lane computes the policy score exactly
+// ((q - s), then minus the penalty when degraded; subtracting 0.0 is exact) and keeps
+// "sc > lane ? sc : lane", which maps onto packed max instructions and, like select(),
+// never lets a NaN win.
+inline double maxWord(const double* q, const double* s, uint64_t word, size_t n) {
+    double lane[kLanes];
+    for (size_t k = 0; k < kLanes; ++k) lane[k] = -std::numeric_limits<double>::infinity();
+    if (word == 0 && n == kWord) {
+        for (size_t j = 0; j < kWord; j += kLanes) {
+            AES11_LANE_LOOP
+            for (size_t k = 0; k < kLanes; ++k) {
+                const double sc = q[j + k] - s[j + k];
+                lane[k] = sc > lane[k] ? sc : lane[k];
+            }
+        }
+    } else {
+        for (size_t j = 0; j < n; ++j) {
+            const double sc = (q[j] - s[j]) - static_cast<double>((word >> j) & 1u) * kPenalty;
+            lane[j % kLanes] = sc > lane[j % kLanes] ? sc : lane[j % kLanes];
+        }
+    }
+    double m = lane[0];
+    for (size_t k = 1; k < kLanes; ++k) m = lane[k] > m ? lane[k] : m;
+    return m;
+}
+
+} // namespace
+
+void SourceTable::assign(const std::vector<SourceMetrics>& sources) {
+    _stability.resize(sources.size());
+    _quality.resize(sources.size());
+    _degraded.assign((sources.size() + 63) / 64, 0);
+    for (size_t i = 0; i < sources.size(); ++i) {
+        _stability[i] = sources[i].stability;
+        _quality[i] = sources[i].quality;
+        if (sources[i].degraded) _degraded[i / 64] |= uint64_t{1} << (i % 64);
+    }
+}
+
+// Pass 1 finds the maximum score and the first 64-entry word that reaches it (a later
+// word replaces it only if strictly greater); pass 2 rescans that word for the first entry
+// equal to the maximum, which is the entry the sequential first-maximum scan keeps.
+SourceTable::ScoredIndex SourceTable::argmax_default() const {
+    const size_t n = size();
+    if (n == 0) return ScoredIndex{0, 0.0};
+    const double first = default_score(0);
+    if (std::isnan(first)) return ScoredIndex{0, first};
+
+    const double* q = _quality.data();
+    const double* s = _stability.data();
+    double best = first;
+    size_t bestBase = 0;
+    for (size_t base = 0; base < n; base += kWord) {
+        const size_t len = n - base < kWord ? n - base : kWord;
+        const double m = maxWord(q + base, s + base, _degraded[base / kWord], len);
+        if (m > best) {
+            best = m;
+            bestBase = base;
+        }
+    }
+
+    const size_t end = n - bestBase < kWord ? n : bestBase + kWord;
+    for (size_t i = bestBase; i < end; ++i) {
+        const double sc = (q[i] - s[i]) - static_cast<double>(degraded(i)) * kPenalty;
+        if (sc == best) return ScoredIndex{i, sc};
+    }
+    return ScoredIndex{0, first}; // unreachable: best is one of the scores
+}
+
+} // namespace sync
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
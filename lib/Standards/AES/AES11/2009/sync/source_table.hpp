@@ -0,0 +1,99 @@
+/*
+ * Original implementation based on understanding of AES-11-2009 Section 4.2
+ * (reference selection for synchronization). No copyrighted text is reproduced.
+ */
+
+#ifndef AES_AES11_2009_SYNC_SOURCE_TABLE_HPP
+#define AES_AES11_2009_SYNC_SOURCE_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "synchronization_manager.hpp"
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace sync {
+
+/**
+ * @brief Structure-of-arrays source metrics for very large source sets
+ *
+ * stability[] and quality[] are contiguous doubles and the degraded flags a bitmask
+ * (bit i of word i / 64), so bulk scoring streams two arrays instead of striding over
+ * SourceMetrics. argmax_default() scores with DefaultScoringPolicy and returns exactly
+ * the index and score the select() scan would find on the equivalent vector (first
+ * maximum; a NaN score never wins, and index 0 wins if its own score is NaN).
+ *
+ * Use with SynchronizationManager::select_bulk(), which adds the usual hysteresis.
+ *
+ * @note Supports REQ-F-SYNC-001 at simulation / plant scale (REQ-NF-PERF-001).
+ */
+class SourceTable {
+public:
+    struct ScoredIndex {
+        size_t index; // size() when the table is empty
+        double score;
+    };
+
+    SourceTable() = default;
+    explicit SourceTable(const std::vector<SourceMetrics>& sources) { assign(sources); }
+
+    // Replace the contents.
+    void assign(const std::vector<SourceMetrics>& sources);
+
+    // New entries are {stability 0, quality 0, not degraded}.
+    void resize(size_t n) {
+        _stability.resize(n, 0.0);
+        _quality.resize(n, 0.0);
+        _degraded.resize((n + 63) / 64, 0);
+        // Clear bits past the end so a later resize does not resurrect stale flags.
+        if (n % 64) _degraded.back() &= (uint64_t{1} << (n % 64)) - 1;
+    }
+
+    void set(size_t i, const SourceMetrics& m) {
+        _stability[i] = m.stability;
+        _quality[i] = m.quality;
+        set_degraded(i, m.degraded);
+    }
+
+    void set_stability(size_t i, double v) { _stability[i] = v; }
+    void set_quality(size_t i, double v) { _quality[i] = v; }
+    void set_degraded(size_t i, bool d) {
+        const uint64_t bit = uint64_t{1} << (i % 64);
+        if (d) {
+            _degraded[i / 64] |= bit;
+        } else {
+            _degraded[i / 64] &= ~bit;
+        }
+    }
+
+    size_t size() const { return _stability.size(); }
+    double stability(size_t i) const { return _stability[i]; }
+    double quality(size_t i) const { return _quality[i]; }
+    bool degraded(size_t i) const { return (_degraded[i / 64] >> (i % 64)) & 1u; }
+    SourceMetrics metrics(size_t i) const { return SourceMetrics{_stability[i], _quality[i], degraded(i)}; }
+
+    const double* stability_data() const { return _stability.data(); }
+    const double* quality_data() const { return _quality.data(); }
+    const uint64_t* degraded_words() const { return _degraded.data(); }
+
+    // DefaultScoringPolicy score of entry i (same arithmetic as the bulk kernel).
+    double default_score(size_t i) const { return DefaultScoringPolicy{}(metrics(i)); }
+
+    // Bulk argmax of the DefaultScoringPolicy score.
+    ScoredIndex argmax_default() const;
+
+private:
+    std::vector<double> _stability;
+    std::vector<double> _quality;
+    std::vector<uint64_t> _degraded;
+};
+
+} // namespace sync
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
+
+#endif // AES_AES11_2009_SYNC_SOURCE_TABLE_HPP
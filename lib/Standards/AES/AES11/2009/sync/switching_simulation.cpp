@@ -0,0 +1,193 @@
+#include "switching_simulation.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+
+#include "../../../../Common/math/splitmix64.hpp"
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace sync {
+
+namespace {
+
+// splitmix64; uniform() in [0, 1), gaussian() by Box-Muller.
+class Rng {
+public:
+    explicit Rng(uint64_t seed) : _state(seed) {}
+
+    double uniform() { return Common::math::splitmix64_unit(_state); }
+
+    double uniform(double lo, double hi) { return lo + (hi - lo) * uniform(); }
+
+    double gaussian() {
+        const double u1 = 1.0 - uniform(); // (0, 1]
+        const double u2 = uniform();
+        return std::sqrt(-2.0 * std::log(u1)) * std::cos(6.283185307179586 * u2);
+    }
+
+    double exponential(double mean) { return -std::log(1.0 - uniform()) * mean; }
+
+private:
+    uint64_t _state;
+};
+
+// Poisson arrivals over [0, durationNs) with exponential lengths; sorted, non-overlapping.
+std::vector<SwitchingSimulation::Window> schedule(Rng& rng, uint64_t durationNs, double perHour, double meanSeconds) {
+    std::vector<SwitchingSimulation::Window> out;
+    if (perHour <= 0.0) return out;
+    double t = rng.exponential(3600.0 / perHour) * 1e9;
+    while (t < static_cast<double>(durationNs)) {
+        const double len = std::max(1.0, rng.exponential(meanSeconds) * 1e9);
+        const uint64_t start = static_cast<uint64_t>(t);
+        const uint64_t end = static_cast<uint64_t>(std::min(t + len, static_cast<double>(durationNs)));
+        if (end > start) out.push_back(SwitchingSimulation::Window{start, end});
+        t += len + rng.exponential(3600.0 / perHour) * 1e9;
+    }
+    return out;
+}
+
+// Windows are visited in time order, so a per-source cursor only moves forward.
+bool inWindow(const std::vector<SwitchingSimulation::Window>& w, size_t& cursor, uint64_t t) {
+    while (cursor < w.size() && w[cursor].endNs <= t) ++cursor;
+    return cursor < w.size() && w[cursor].startNs <= t;
+}
+
+uint64_t percentileOf(const std::vector<uint64_t>& sorted, double p) {
+    if (sorted.empty()) return 0;
+    return sorted[static_cast<size_t>(p / 100.0 * static_cast<double>(sorted.size() - 1))];
+}
+
+} // namespace
+
+SwitchingSimulation::SwitchingSimulation(const Config& cfg) : _cfg(cfg) {
+    if (!(_cfg.selectionRateHz > 0.0)) _cfg.selectionRateHz = 1.0;
+}
+
+SwitchingSimulation::Config SwitchingSimulation::generate(const Scenario& s) {
+    Rng rng(s.seed);
+    Config cfg;
+    cfg.durationNs = s.durationNs;
+    cfg.seed = s.seed ^ 0x5A5A5A5A5A5A5A5AULL;
+    cfg.sources.resize(s.sourceCount);
+    for (auto& src : cfg.sources) {
+        src.quality = rng.uniform(s.qualityMin, s.qualityMax);
+        src.frequencyPpm = rng.uniform(-s.frequencyPpmSpread, s.frequencyPpmSpread);
+        src.driftPpmPerHour = rng.uniform(-s.driftPpmPerHourSpread, s.driftPpmPerHourSpread);
+        src.noise = s.noise;
+        src.dropouts = schedule(rng, s.durationNs, s.dropoutsPerHour, s.dropoutMeanSeconds);
+        src.degradations = schedule(rng, s.durationNs, s.degradationsPerHour, s.degradationMeanSeconds);
+    }
+    return cfg;
+}
+
+SwitchingSimulation::Report SwitchingSimulation::run() {
+    const size_t n = _cfg.sources.size();
+    const size_t none = SynchronizationManager::invalidIndex();
+    const uint64_t interval = std::max<uint64_t>(1, static_cast<uint64_t>(std::llround(1e9 / _cfg.selectionRateHz)));
+    const DefaultScoringPolicy policy{};
+
+    Rng rng(_cfg.seed);
+    SynchronizationManager manager(_cfg.hysteresisMargin);
+    std::vector<SourceMetrics> metrics(n, SourceMetrics{0.0, 0.0, false});
+    std::vector<double> trueScore(n, 0.0);
+    std::vector<uint8_t> present(n, 0);
+    std::vector<uint8_t> inManager(n, 0);
+    std::vector<size_t> dropCursor(n, 0), degradeCursor(n, 0);
+    std::vector<uint64_t> latencies;
+    latencies.reserve(static_cast<size_t>(_cfg.durationNs / interval + 1));
+
+    Report r{};
+    r.sources = n;
+    size_t last = none;
+    const auto wall0 = std::chrono::steady_clock::now();
+    for (uint64_t t = 0; t < _cfg.durationNs; t += interval) {
+        const double hours = static_cast<double>(t) / 3.6e12;
+        double bestTrue = -std::numeric_limits<double>::infinity();
+        size_t bestTrueId = none;
+        for (size_t i = 0; i < n; ++i) {
+            const Source& src = _cfg.sources[i];
+            present[i] = !inWindow(src.dropouts, dropCursor[i], t);
+            const bool degraded = inWindow(src.degradations, degradeCursor[i], t);
+            const double qTrue = src.quality - _cfg.ppmPenalty * std::fabs(src.frequencyPpm + src.driftPpmPerHour * hours);
+            trueScore[i] = policy(SourceMetrics{src.stability, qTrue, degraded});
+            if (present[i] && trueScore[i] > bestTrue) {
+                bestTrue = trueScore[i];
+                bestTrueId = i;
+            }
+            const double observed = qTrue + (src.noise > 0.0 ? src.noise * rng.gaussian() : 0.0);
+            metrics[i] = present[i] ? SourceMetrics{src.stability, observed, degraded}
+                                    : SourceMetrics{src.stability, -1e9, true};
+        }
+
+        const auto t0 = std::chrono::steady_clock::now();
+        size_t selected;
+        if (_cfg.mode == Mode::Full) {
+            selected = manager.select(metrics);
+        } else {
+            for (size_t i = 0; i < n; ++i) {
+                if (present[i]) {
+                    manager.update_source(i, metrics[i]);
+                    inManager[i] = 1;
+                } else if (inManager[i]) {
+                    manager.remove_source(i);
+                    inManager[i] = 0;
+                }
+            }
+            selected = manager.best();
+        }
+        const auto t1 = std::chrono::steady_clock::now();
+        const uint64_t lat = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+        latencies.push_back(lat);
+        r.selectionWallNs += lat;
+
+        ++r.selections;
+        if (last != none && selected != last) ++r.switches;
+        last = selected;
+        const double selectedTrue = (selected < n && present[selected]) ? trueScore[selected]
+                                                                         : -std::numeric_limits<double>::infinity();
+        if (bestTrueId != none && selectedTrue < bestTrue) {
+            ++r.suboptimalSelections;
+            r.suboptimalNs += std::min(interval, _cfg.durationNs - t);
+        }
+    }
+    const auto wall1 = std::chrono::steady_clock::now();
+    r.wallNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(wall1 - wall0).count());
+    r.simulatedNs = _cfg.durationNs;
+
+    std::sort(latencies.begin(), latencies.end());
+    r.latencyP50Ns = percentileOf(latencies, 50.0);
+    r.latencyP99Ns = percentileOf(latencies, 99.0);
+    r.latencyP999Ns = percentileOf(latencies, 99.9);
+    r.latencyMaxNs = latencies.empty() ? 0 : latencies.back();
+    return r;
+}
+
+std::string to_json(const SwitchingSimulation::Report& r, SwitchingSimulation::Mode mode, double hysteresisMargin) {
+    char buf[1024];
+    std::snprintf(buf, sizeof(buf),
+                  "{\"mode\":\"%s\",\"sources\":%llu,\"hysteresis_margin\":%.6g,\"selections\":%llu,"
+                  "\"switches\":%llu,\"suboptimal_selections\":%llu,\"suboptimal_ns\":%llu,"
+                  "\"suboptimal_fraction\":%.6g,\"simulated_ns\":%llu,\"latency_ns\":{\"p50\":%llu,"
+                  "\"p99\":%llu,\"p999\":%llu,\"max\":%llu},\"selections_per_second\":%.6g,"
+                  "\"simulated_seconds_per_wall_second\":%.6g,\"wall_ns\":%llu}",
+                  mode == SwitchingSimulation::Mode::Full ? "full" : "incremental",
+                  static_cast<unsigned long long>(r.sources), hysteresisMargin,
+                  static_cast<unsigned long long>(r.selections), static_cast<unsigned long long>(r.switches),
+                  static_cast<unsigned long long>(r.suboptimalSelections),
+                  static_cast<unsigned long long>(r.suboptimalNs), r.suboptimalFraction(),
+                  static_cast<unsigned long long>(r.simulatedNs), static_cast<unsigned long long>(r.latencyP50Ns),
+                  static_cast<unsigned long long>(r.latencyP99Ns), static_cast<unsigned long long>(r.latencyP999Ns),
+                  static_cast<unsigned long long>(r.latencyMaxNs), r.selectionsPerSecond(),
+                  r.simulatedSecondsPerWallSecond(), static_cast<unsigned long long>(r.wallNs));
+    return std::string(buf);
+}
+
+} // namespace sync
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
@@ -0,0 +1,133 @@
+/*
+ * Original implementation based on understanding of AES-11-2009 Sections 4.2
+ * (reference selection) and 5.2 (frequency accuracy). No copyrighted text is
+ * reproduced.
+ */
+
+#ifndef AES_AES11_2009_SYNC_SWITCHING_SIMULATION_HPP
+#define AES_AES11_2009_SYNC_SWITCHING_SIMULATION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "synchronization_manager.hpp"
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace sync {
+
+/**
+ * @brief Reference-switching simulation for SynchronizationManager hysteresis
+ *
+ * N sources are sampled once per selection interval of simulated time. Per source the
+ * noiseless quality is quality - ppmPenalty * |frequencyPpm + driftPpmPerHour * t|;
+ * the manager sees it plus Gaussian noise (noise = standard deviation), the fixed
+ * stability, and degraded = true inside a degradation window. Sources inside a dropout
+ * window are absent (remove_source() on the incremental path; quality -1e9 and degraded
+ * for select()).
+ *
+ * Ground truth at each selection is the present source with the best noiseless
+ * DefaultScoringPolicy score; selection intervals spent on a source scoring below it
+ * (or on none while one is present) count as suboptimal time. Only the selection call
+ * (metric hand-over plus select()/best()) is timed for latency and throughput.
+ *
+ * @note Supports REQ-F-SYNC-001 tuning and scaling measurements.
+ */
+class SwitchingSimulation {
+public:
+    enum class Mode : uint8_t {
+        Full,        // select() over the full metrics vector each interval
+        Incremental  // update_source() per source, then best()
+    };
+
+    struct Window {
+        uint64_t startNs;
+        uint64_t endNs; // exclusive
+    };
+
+    struct Source {
+        double quality = 1.0;
+        double stability = 0.0;
+        double frequencyPpm = 0.0;
+        double driftPpmPerHour = 0.0;
+        double noise = 0.0;
+        std::vector<Window> dropouts;
+        std::vector<Window> degradations;
+    };
+
+    struct Config {
+        std::vector<Source> sources;
+        uint64_t durationNs = 60'000'000'000ULL;
+        double selectionRateHz = 10.0;
+        double hysteresisMargin = 0.1;
+        double ppmPenalty = 0.1; // quality points per ppm of frequency error
+        Mode mode = Mode::Incremental;
+        uint64_t seed = 1;
+    };
+
+    // Random schedule generator: sources spread uniformly in quality / frequency / drift,
+    // dropouts and degradations as Poisson arrivals with exponential durations.
+    struct Scenario {
+        size_t sourceCount = 16;
+        uint64_t durationNs = 60'000'000'000ULL;
+        double qualityMin = 0.8;
+        double qualityMax = 1.0;
+        double frequencyPpmSpread = 1.0;     // ±
+        double driftPpmPerHourSpread = 0.5;  // ±
+        double noise = 0.01;
+        double dropoutsPerHour = 0.0;        // per source
+        double dropoutMeanSeconds = 5.0;
+        double degradationsPerHour = 0.0;    // per source
+        double degradationMeanSeconds = 30.0;
+        uint64_t seed = 1;
+    };
+
+    struct Report {
+        size_t sources;
+        uint64_t selections;
+        uint64_t switches;
+        uint64_t suboptimalSelections;
+        uint64_t suboptimalNs;
+        uint64_t simulatedNs;
+        uint64_t selectionWallNs;  // total time inside selection calls
+        uint64_t wallNs;           // whole run
+        uint64_t latencyP50Ns;
+        uint64_t latencyP99Ns;
+        uint64_t latencyP999Ns;
+        uint64_t latencyMaxNs;
+
+        double suboptimalFraction() const {
+            return simulatedNs ? static_cast<double>(suboptimalNs) / static_cast<double>(simulatedNs) : 0.0;
+        }
+        double selectionsPerSecond() const {
+            return selectionWallNs ? static_cast<double>(selections) * 1e9 / static_cast<double>(selectionWallNs)
+                                   : 0.0;
+        }
+        double simulatedSecondsPerWallSecond() const {
+            return wallNs ? static_cast<double>(simulatedNs) / static_cast<double>(wallNs) : 0.0;
+        }
+    };
+
+    explicit SwitchingSimulation(const Config& cfg);
+
+    static Config generate(const Scenario& scenario);
+
+    Report run();
+
+private:
+    Config _cfg;
+};
+
+// Single-line JSON object with every Report field plus the derived rates.
+std::string to_json(const SwitchingSimulation::Report& report, SwitchingSimulation::Mode mode,
+                    double hysteresisMargin);
+
+} // namespace sync
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
+
+#endif // AES_AES11_2009_SYNC_SWITCHING_SIMULATION_HPP
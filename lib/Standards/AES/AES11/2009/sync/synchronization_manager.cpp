@@ -1,3 +1,25 @@
 #include "synchronization_manager.hpp"
+#include "../../../../Common/reliability/metrics.hpp"
 
-// Implementation in header; this TU anchors the component for the build and future expansion.
+// Selection logic lives in the header; this TU anchors the component and records
+// failovers in the shared reliability metrics.
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace sync {
+
+template class BasicSynchronizationManager<DefaultScoringPolicy>;
+
+void record_failover(uint64_t latencyNs, FailoverMetrics& m) {
+    ++m.count;
+    m.lastLatencyNs = latencyNs;
+    m.totalLatencyNs += latencyNs;
+    if (latencyNs > m.maxLatencyNs) m.maxLatencyNs = latencyNs;
+    Common::reliability::ReliabilityMetrics::incrementSourceFailover(latencyNs);
+}
+
+} // namespace sync
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
@@ -1,13 +1,30 @@
 // Synchronization Manager - DES-C-002
 // Provides source selection with hysteresis and hooks for degradation/holdover.
 // Hardware-agnostic; operates on abstract source metric inputs.
+// Two entry points share the hysteresis state: select() rescans a full metrics vector;
+// update_source()/best() keep cached scores in a tournament tree so that one source
+// update costs O(log n). Use one style per manager instance. select_bulk() is select()
+// over a structure-of-arrays SourceTable with a vectorized scoring kernel.
+// The incremental path also keeps a ranked backup list (top-k, maintained on each update
+// and refilled from the tree in O(k log n) when it runs low) so failover() on a
+// degradation event switches in constant time, without a rescan.
+// Scoring is a compile-time policy (BasicSynchronizationManager<Policy>), inlined with no
+// virtual dispatch; SynchronizationManager uses DefaultScoringPolicy. Further policies
+// live in scoring_policies.hpp. A policy may name a wider input (metrics_type, e.g.
+// ExtendedSourceMetrics); the default keeps the three-field SourceMetrics layout.
 
 #ifndef AES_AES11_2009_SYNC_SYNCHRONIZATION_MANAGER_HPP
 #define AES_AES11_2009_SYNC_SYNCHRONIZATION_MANAGER_HPP
 
+#include <algorithm>
 #include <vector>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
+#include <type_traits>
+
+#include "../core/channel_status_utils.hpp"
+#include "../core/timing_snapshot_service.hpp"
 
 namespace AES {
 namespace AES11 {
@@ -20,14 +37,70 @@ struct SourceMetrics {
     bool   degraded;    // flag indicating current degradation
 };
 
-class SynchronizationManager {
+// Inputs for scoring policies beyond the default (scoring_policies.hpp). Converts to
+// SourceMetrics, so producers of this type can also feed a default-policy manager.
+struct ExtendedSourceMetrics : SourceMetrics {
+    double mtieNs = 0.0;   // maximum time interval error over the policy's window
+    double ppmError = 0.0; // signed frequency error vs nominal
+    core::DARSGrade grade = core::DARSGrade::Unknown; // advertised in channel status byte 4
+};
+
+// Score used since the first release: quality minus stability, fixed degraded penalty.
+// A scoring policy is any copyable type with double operator()(const metrics_type&) const
+// returning "higher is better"; metrics_type defaults to SourceMetrics when not declared.
+struct DefaultScoringPolicy {
+    static constexpr double kDegradedPenalty = 10.0;
+
+    double operator()(const SourceMetrics& m) const {
+        // Basic composite: prioritize non-degraded, then quality, inverse stability.
+        double base = m.quality - m.stability; // higher quality, lower stability value = better
+        if (m.degraded) base -= kDegradedPenalty; // penalty; future refinement may scale
+        return base;
+    }
+};
+
+// Failover latency (degradation event to switched reference), measured with the attached
+// TimingSnapshotService; latencies stay 0 when no service is attached.
+struct FailoverMetrics {
+    uint64_t count{0};
+    uint64_t lastLatencyNs{0};
+    uint64_t maxLatencyNs{0};
+    uint64_t totalLatencyNs{0};
+
+    double meanLatencyNs() const {
+        return count ? static_cast<double>(totalLatencyNs) / static_cast<double>(count) : 0.0;
+    }
+};
+
+namespace detail {
+template <typename Policy, typename = void>
+struct policy_metrics {
+    using type = SourceMetrics;
+};
+template <typename Policy>
+struct policy_metrics<Policy, decltype(void(sizeof(typename Policy::metrics_type)))> {
+    using type = typename Policy::metrics_type;
+};
+} // namespace detail
+
+// Updates FailoverMetrics and the shared reliability counters (see the .cpp).
+void record_failover(uint64_t latencyNs, FailoverMetrics& metrics);
+
+template <typename ScoringPolicy = DefaultScoringPolicy>
+class BasicSynchronizationManager {
 public:
-    explicit SynchronizationManager(double hysteresisMargin)
-        : _hysteresisMargin(hysteresisMargin), _currentIndex(std::numeric_limits<size_t>::max()) {}
+    using policy_type = ScoringPolicy;
+    using metrics_type = typename detail::policy_metrics<ScoringPolicy>::type;
+
+    static constexpr size_t kDefaultBackupDepth = 8;
+
+    explicit BasicSynchronizationManager(double hysteresisMargin, ScoringPolicy policy = ScoringPolicy{})
+        : _hysteresisMargin(hysteresisMargin), _currentIndex(std::numeric_limits<size_t>::max()),
+          _policy(policy) {}
 
     // Select best source based on quality while applying hysteresis to avoid rapid churn.
     // Returns index of selected source.
-    size_t select(const std::vector<SourceMetrics>& sources) {
+    size_t select(const std::vector<metrics_type>& sources) {
         if (sources.empty()) return invalidIndex();
 
         size_t best = 0;
@@ -55,22 +128,256 @@ public:
         return _currentIndex;
     }
 
+    // Bulk path for large source sets: same decision and hysteresis as select() on the
+    // equivalent vector, scored by the vectorized kernel of a SourceTable (source_table.hpp).
+    // DefaultScoringPolicy only. A current index beyond the table selects afresh.
+    template <typename Table>
+    size_t select_bulk(const Table& table) {
+        static_assert(std::is_same<ScoringPolicy, DefaultScoringPolicy>::value,
+                      "SourceTable kernels implement DefaultScoringPolicy");
+        if (table.size() == 0) return invalidIndex();
+        const auto best = table.argmax_default();
+        if (_currentIndex == invalidIndex() || _currentIndex >= table.size()) {
+            _currentIndex = best.index;
+            return _currentIndex;
+        }
+        if (table.default_score(_currentIndex) + _hysteresisMargin >= best.score) {
+            return _currentIndex; // hold current
+        }
+        _currentIndex = best.index;
+        return _currentIndex;
+    }
+
+    // Incremental API: record new metrics for source id (ids need not be contiguous;
+    // storage grows to the largest id seen). O(log n).
+    void update_source(size_t id, const metrics_type& metrics) {
+        if (id >= _leafCount) grow(id + 1);
+        if (id >= _sourceCount) _sourceCount = id + 1;
+        if (!_active[id]) ++_activeCount;
+        _scores[id] = score(metrics);
+        _metrics[id] = metrics;
+        _active[id] = 1;
+        replay(id);
+        rerank(id);
+    }
+
+    // Withdraw source id from selection (e.g., input lost). O(log n).
+    void remove_source(size_t id) {
+        if (id >= _sourceCount || !_active[id]) return;
+        _active[id] = 0;
+        --_activeCount;
+        replay(id);
+        rerank(id);
+    }
+
+    // Degradation event for source id. If id is the current reference, switch to the
+    // highest-ranked backup in O(k) (k = backup depth, independent of the source count);
+    // the degraded source is then rescored as if updated with degraded = true, so best()
+    // does not switch back. Returns the selected source.
+    size_t failover(size_t id) {
+        if (id >= _sourceCount || !_active[id]) return _currentIndex;
+        if (id != _currentIndex) {
+            demote(id);
+            return _currentIndex;
+        }
+        const core::TimingSnapshot t0 = _timing ? _timingSnapshot(_timing) : core::TimingSnapshot{};
+        size_t next = invalidIndex();
+        for (size_t b : _backups) {
+            if (b != id) {
+                next = b;
+                break;
+            }
+        }
+        _currentIndex = next;
+        const core::TimingSnapshot t1 = _timing ? _timingSnapshot(_timing) : core::TimingSnapshot{};
+        // Bookkeeping after the switch (O(log n) tree replay) is outside the measured latency.
+        demote(id);
+        if (_currentIndex == invalidIndex()) _currentIndex = best_candidate();
+        record_failover(_timing ? t1.time_ns - t0.time_ns : 0, _failover);
+        return _currentIndex;
+    }
+
+    // Ranked backups, best first (the current reference is usually first).
+    const std::vector<size_t>& backups() const { return _backups; }
+
+    void set_backup_depth(size_t depth) {
+        _backupDepth = depth < 2 ? 2 : depth;
+        rebuildRanking();
+    }
+
+    // Timestamp source for failover latency, for any clock type (not owned; nullptr
+    // detaches). One indirect call per snapshot, taken only on failover.
+    template <typename Clock>
+    void attach_timing(core::TimingSnapshotService<Clock>* timing) {
+        _timing = timing;
+        _timingSnapshot = [](void* service) {
+            return static_cast<core::TimingSnapshotService<Clock>*>(service)->snapshot();
+        };
+    }
+    void attach_timing(std::nullptr_t) { _timing = nullptr; }
+
+    const FailoverMetrics& failover_metrics() const { return _failover; }
+
+    // Best-scoring active source (lowest id on ties), ignoring hysteresis. O(1).
+    size_t best_candidate() const {
+        if (_leafCount == 0) return invalidIndex();
+        const size_t w = _tree[1];
+        return _active[w] ? w : invalidIndex();
+    }
+
+    // Selection with the same hysteresis as select(): the current source is kept while its
+    // score is within the margin of the best candidate. Current is dropped only if removed.
+    size_t best() {
+        const size_t candidate = best_candidate();
+        if (candidate == invalidIndex()) {
+            _currentIndex = invalidIndex();
+            return _currentIndex;
+        }
+        if (_currentIndex == invalidIndex() || _currentIndex >= _sourceCount || !_active[_currentIndex]) {
+            _currentIndex = candidate;
+            return _currentIndex;
+        }
+        if (_scores[_currentIndex] + _hysteresisMargin >= _scores[candidate]) {
+            return _currentIndex; // hold current
+        }
+        _currentIndex = candidate;
+        return _currentIndex;
+    }
+
+    size_t source_count() const { return _sourceCount; }
+
+    // Last metrics recorded for id by update_source() (with degraded set by failover()).
+    const metrics_type& source_metrics(size_t id) const { return _metrics[id]; }
+
     size_t current() const { return _currentIndex; }
 
+    const ScoringPolicy& policy() const { return _policy; }
+
     static size_t invalidIndex() { return std::numeric_limits<size_t>::max(); }
 
 private:
-    double score(const SourceMetrics& m) const {
-        // Basic composite: prioritize non-degraded, then quality, inverse stability.
-        double base = m.quality - m.stability; // higher quality, lower stability value = better
-        if (m.degraded) base -= 10.0; // penalty; future refinement may scale
-        return base;
+    double score(const metrics_type& m) const { return _policy(m); }
+
+    // Winner of a match: active beats inactive, then higher score, then lower id (the
+    // same tie-break as select(), which keeps the first maximum).
+    size_t winner(size_t a, size_t b) const {
+        if (_active[a] != _active[b]) return _active[a] ? a : b;
+        if (_scores[a] != _scores[b]) return _scores[a] > _scores[b] ? a : b;
+        return a < b ? a : b;
+    }
+
+    bool ranksAbove(size_t a, size_t b) const { return a != b && winner(a, b) == a; }
+
+    // Keep _backups the exact top-m active sources (m <= depth) after id changed. Removing
+    // id keeps the rest exact; id is re-inserted only where that provably stays exact
+    // (it outranks the last entry, or every other active source is already listed).
+    // A list drained below half depth is refilled from the tournament tree (O(k log n)).
+    void rerank(size_t id) {
+        for (size_t i = 0; i < _backups.size(); ++i) {
+            if (_backups[i] == id) {
+                _backups.erase(_backups.begin() + static_cast<std::ptrdiff_t>(i));
+                break;
+            }
+        }
+        if (_active[id]) {
+            const bool complete = _backups.size() + 1 == _activeCount;
+            if (complete || (!_backups.empty() && ranksAbove(id, _backups.back()))) {
+                size_t pos = _backups.size();
+                while (pos > 0 && ranksAbove(id, _backups[pos - 1])) --pos;
+                _backups.insert(_backups.begin() + static_cast<std::ptrdiff_t>(pos), id);
+                if (_backups.size() > _backupDepth) _backups.pop_back();
+            }
+        }
+        const size_t want = _activeCount < _backupDepth / 2 ? _activeCount : _backupDepth / 2;
+        if (_backups.size() < want) rebuildRanking();
+    }
+
+    // Exact top-k by a best-first walk of the tree: a heap of subtrees keyed by their
+    // winners. Taking a subtree's winner exposes the sibling subtrees along its path, so
+    // each extraction costs O(log n) pushes; no source outside those paths is visited.
+    void rebuildRanking() {
+        _backups.clear();
+        _frontier.clear();
+        if (_leafCount == 0) return;
+        // Max-heap: a sorts below b when b's winner ranks above a's.
+        const auto below = [this](size_t a, size_t b) { return ranksAbove(_tree[b], _tree[a]); };
+        _frontier.push_back(1);
+        while (_backups.size() < _backupDepth && !_frontier.empty()) {
+            std::pop_heap(_frontier.begin(), _frontier.end(), below);
+            size_t node = _frontier.back();
+            _frontier.pop_back();
+            const size_t w = _tree[node];
+            if (!_active[w]) break; // active sources win every match: the rest are inactive
+            _backups.push_back(w);
+            while (node < _leafCount) {
+                const size_t left = 2 * node;
+                const bool wentLeft = _tree[left] == w;
+                _frontier.push_back(wentLeft ? left + 1 : left);
+                std::push_heap(_frontier.begin(), _frontier.end(), below);
+                node = wentLeft ? left : left + 1;
+            }
+        }
+    }
+
+    void demote(size_t id) {
+        if (_metrics[id].degraded) return;
+        _metrics[id].degraded = true;
+        _scores[id] = score(_metrics[id]);
+        replay(id);
+        rerank(id);
+    }
+
+    // Re-run the matches on the path from leaf id to the root.
+    void replay(size_t id) {
+        size_t node = (_leafCount + id) / 2;
+        while (node >= 1) {
+            _tree[node] = winner(_tree[2 * node], _tree[2 * node + 1]);
+            node /= 2;
+        }
+    }
+
+    // Resize to the next power of two >= n leaves and rebuild all matches (amortised O(1)).
+    void grow(size_t n) {
+        size_t leaves = _leafCount ? _leafCount : 1;
+        while (leaves < n) leaves *= 2;
+        _scores.resize(leaves, -std::numeric_limits<double>::infinity());
+        _active.resize(leaves, 0);
+        _metrics.resize(leaves, metrics_type{});
+        _tree.assign(2 * leaves, 0);
+        _leafCount = leaves;
+        for (size_t i = 0; i < leaves; ++i) _tree[leaves + i] = i;
+        for (size_t node = leaves - 1; node >= 1; --node) {
+            _tree[node] = winner(_tree[2 * node], _tree[2 * node + 1]);
+        }
     }
 
     double _hysteresisMargin;
     size_t _currentIndex;
+    ScoringPolicy _policy;
+
+    // Incremental selection state: _tree[1] is the overall winner; leaves live at
+    // _tree[_leafCount + id] (a one-leaf tree stores its only source at _tree[1]).
+    std::vector<double> _scores;
+    std::vector<uint8_t> _active;
+    std::vector<metrics_type> _metrics; // last metrics per source (rescored on failover)
+    std::vector<size_t> _tree;
+    size_t _leafCount{0};
+    size_t _sourceCount{0};
+    size_t _activeCount{0};
+
+    // Failover ranking and instrumentation.
+    std::vector<size_t> _backups;
+    std::vector<size_t> _frontier; // rebuildRanking() scratch, kept to avoid reallocating
+    size_t _backupDepth{kDefaultBackupDepth};
+    void* _timing{nullptr};
+    core::TimingSnapshot (*_timingSnapshot)(void*){nullptr};
+    FailoverMetrics _failover{};
 };
 
+using SynchronizationManager = BasicSynchronizationManager<>;
+
+extern template class BasicSynchronizationManager<DefaultScoringPolicy>;
+
 } // namespace sync
 } // namespace _2009
 } // namespace AES11
@@ -0,0 +1,166 @@
+#include "tie_recorder.hpp"
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace sync {
+
+namespace {
+
+uint64_t zigzag(int64_t v) { return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v < 0 ? -1 : 0); }
+int64_t unzigzag(uint64_t u) { return static_cast<int64_t>(u >> 1) ^ -static_cast<int64_t>(u & 1); }
+
+} // namespace
+
+TieRecorder::TieRecorder(const Config& cfg) : _cfg(cfg) {
+    if (_cfg.blockSamples == 0) _cfg.blockSamples = 1;
+}
+
+void TieRecorder::append(int64_t tieNs) {
+    if (tieNs > kMaxAbsTieNs) tieNs = kMaxAbsTieNs;
+    if (tieNs < -kMaxAbsTieNs) tieNs = -kMaxAbsTieNs;
+    if (_blockLeft == 0) {
+        flushRun();
+        _blocks.push_back(Block{_bytes.size(), tieNs});
+        _blockLeft = _cfg.blockSamples;
+        _prevDelta = 0;
+    } else {
+        // |tie| <= 2^59 bounds |delta| <= 2^60 and |dod| <= 2^61, so zigzag(dod) <= 2^62
+        // and the literal token zigzag(dod) << 1 stays below 2^64.
+        const int64_t delta = tieNs - _prev;
+        const int64_t dod = delta - _prevDelta;
+        if (dod == 0) {
+            ++_run;
+        } else {
+            flushRun();
+            putVarint(zigzag(dod) << 1);
+        }
+        _prevDelta = delta;
+    }
+    _prev = tieNs;
+    --_blockLeft;
+    ++_count;
+}
+
+void TieRecorder::append(const int64_t* tieNs, size_t count) {
+    for (size_t i = 0; i < count; ++i) append(tieNs[i]);
+}
+
+void TieRecorder::append(core::PhaseOffset offset) {
+    const int64_t half = int64_t{1} << 31;
+    const int64_t ns = offset.q32 >= 0 ? (offset.q32 + half) / (int64_t{1} << 32)
+                                       : -((half - offset.q32) / (int64_t{1} << 32));
+    append(ns);
+}
+
+void TieRecorder::clear() {
+    _bytes.clear();
+    _blocks.clear();
+    _count = 0;
+    _prev = 0;
+    _prevDelta = 0;
+    _run = 0;
+    _blockLeft = 0;
+}
+
+void TieRecorder::flushRun() {
+    if (_run == 0) return;
+    putVarint((_run << 1) | 1u);
+    _run = 0;
+}
+
+void TieRecorder::putVarint(uint64_t v) {
+    while (v >= 0x80) {
+        _bytes.push_back(static_cast<uint8_t>(v | 0x80));
+        v >>= 7;
+    }
+    _bytes.push_back(static_cast<uint8_t>(v));
+}
+
+size_t TieRecorder::decode(uint64_t first, int64_t* out, size_t count) const {
+    Cursor c = cursor(first);
+    size_t n = 0;
+    while (n < count) {
+        const size_t got = c.read(out + n, count - n);
+        if (got == 0) break;
+        n += got;
+    }
+    return n;
+}
+
+TieRecorder::Cursor::Cursor(const TieRecorder* rec, uint64_t first) : _rec(rec) {
+    if (first > rec->_count) first = rec->_count;
+    // Start at the block boundary (read() enters the block there) and decode the lead-in.
+    _pos = first - first % rec->_cfg.blockSamples;
+    int64_t scratch[256];
+    while (_pos < first) {
+        const uint64_t skip = first - _pos;
+        read(scratch, skip < 256 ? static_cast<size_t>(skip) : 256);
+    }
+}
+
+size_t TieRecorder::Cursor::read(int64_t* out, size_t max) {
+    const TieRecorder& r = *_rec;
+    size_t n = 0;
+    while (n < max && _pos < r._count) {
+        if (_blockLeft == 0) {
+            const size_t blk = static_cast<size_t>(_pos / r._cfg.blockSamples);
+            _bytePos = static_cast<size_t>(r._blocks[blk].byteOffset);
+            _byteEnd = blk + 1 < r._blocks.size() ? static_cast<size_t>(r._blocks[blk + 1].byteOffset)
+                                                  : r._bytes.size();
+            _value = r._blocks[blk].firstValue;
+            _delta = 0;
+            _run = 0;
+            _blockLeft = r._cfg.blockSamples - 1;
+            out[n++] = _value;
+            ++_pos;
+            continue;
+        }
+        if (_run == 0) {
+            if (_bytePos < _byteEnd) {
+                const uint8_t* p = r._bytes.data();
+                uint64_t tok = 0;
+                unsigned shift = 0;
+                uint8_t b;
+                do {
+                    b = p[_bytePos++];
+                    tok |= static_cast<uint64_t>(b & 0x7F) << shift;
+                    shift += 7;
+                } while (b & 0x80);
+                if (tok & 1) {
+                    _run = tok >> 1;
+                } else {
+                    _delta += unzigzag(tok >> 1);
+                    _value += _delta;
+                    out[n++] = _value;
+                    ++_pos;
+                    --_blockLeft;
+                    continue;
+                }
+            } else {
+                // Only the open (last) block ends in a run that is not yet written.
+                _run = r._run;
+                if (_run == 0) break;
+            }
+        }
+        uint64_t k = _run;
+        if (k > max - n) k = max - n;
+        if (k > _blockLeft) k = _blockLeft;
+        if (k > r._count - _pos) k = r._count - _pos;
+        // Constant drift: independent lanes, no loop-carried dependency.
+        const int64_t v0 = _value, d = _delta;
+        int64_t* dst = out + n;
+        for (uint64_t i = 0; i < k; ++i) dst[i] = v0 + static_cast<int64_t>(i + 1) * d;
+        _value = v0 + static_cast<int64_t>(k) * d;
+        _run -= k;
+        _blockLeft -= k;
+        _pos += k;
+        n += static_cast<size_t>(k);
+    }
+    return n;
+}
+
+} // namespace sync
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
@@ -0,0 +1,126 @@
+/*
+ * Original implementation based on understanding of AES-11-2009 Section 4.2.4
+ * (GPS-referenced synchronization) and Section 5.3.1 (TRP phase). No copyrighted
+ * text is reproduced.
+ */
+
+#ifndef AES_AES11_2009_SYNC_TIE_RECORDER_HPP
+#define AES_AES11_2009_SYNC_TIE_RECORDER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../core/frame_phase.hpp"
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace sync {
+
+/**
+ * @brief Compressed time-interval-error (TIE) capture for long recordings
+ *
+ * Stores one TIE value per TRP (integer ns, e.g. trp - pps or a core::FramePhase
+ * offset) as delta-of-delta tokens in LEB128 varints:
+ * - a non-zero delta-of-delta is a literal token (zigzag(dod) << 1)
+ * - a run of zero delta-of-deltas (constant drift, the common case for slowly
+ *   wandering TIE) is one token ((runLength << 1) | 1)
+ * so flat or linearly drifting stretches cost a few bytes per run and jitter of a few
+ * ns costs one byte per TRP. Storage therefore depends on the input noise: noise-free
+ * wander at 48 kHz stays in the megabytes per day, but any per-TRP jitter of a few ns
+ * puts the floor at about 8 bits per TRP (~4 GB per day at 48 kHz, still 8x below raw
+ * int64). Samples are grouped into fixed-size blocks whose first
+ * value and byte offset are indexed, so a range decode seeks to its block directly
+ * and decodes at most one block of lead-in.
+ *
+ * Single-threaded; a Cursor is valid until the next append() or clear().
+ *
+ * @note Supports REQ-F-DARS-006 (GPS-Referenced Synchronization) evidence capture for
+ *       offline stability / MTIE analysis.
+ */
+class TieRecorder {
+public:
+    struct Config {
+        size_t blockSamples = 65536; // samples per seekable block (index costs 16 bytes each)
+    };
+
+    // TIE values are clamped to ±2^59 ns so every delta-of-delta token fits 64 bits.
+    static constexpr int64_t kMaxAbsTieNs = int64_t{1} << 59;
+
+    TieRecorder() : TieRecorder(Config{}) {}
+    explicit TieRecorder(const Config& cfg);
+
+    void append(int64_t tieNs);
+    void append(const int64_t* tieNs, size_t count);
+    // Rounded to the nearest ns (halves away from zero).
+    void append(core::PhaseOffset offset);
+
+    uint64_t size() const { return _count; }
+    bool empty() const { return _count == 0; }
+    // Encoded payload plus block index, in bytes.
+    size_t bytes() const { return _bytes.size() + _blocks.size() * sizeof(Block); }
+    double bits_per_sample() const {
+        return _count ? 8.0 * static_cast<double>(bytes()) / static_cast<double>(_count) : 0.0;
+    }
+
+    void clear();
+
+    /**
+     * @brief Sequential decoder starting at a sample index
+     *
+     * read() fills up to max values and returns how many it wrote (0 at the end), so a
+     * capture can be streamed through an analysis in fixed-size chunks.
+     */
+    class Cursor {
+    public:
+        size_t read(int64_t* out, size_t max);
+        uint64_t position() const { return _pos; }
+        bool done() const { return _pos >= _rec->_count; }
+
+    private:
+        friend class TieRecorder;
+        Cursor(const TieRecorder* rec, uint64_t first);
+
+        const TieRecorder* _rec;
+        uint64_t _pos{0};
+        uint64_t _blockLeft{0}; // samples left in the current block
+        size_t _bytePos{0};
+        size_t _byteEnd{0};
+        int64_t _value{0};
+        int64_t _delta{0};
+        uint64_t _run{0};
+    };
+
+    // Cursor at sample first (clamped to size()).
+    Cursor cursor(uint64_t first) const { return Cursor(this, first); }
+
+    // Decodes samples [first, first + count) into out; returns the number written
+    // (fewer than count when the range runs past size()).
+    size_t decode(uint64_t first, int64_t* out, size_t count) const;
+
+private:
+    struct Block {
+        uint64_t byteOffset;
+        int64_t firstValue;
+    };
+
+    void flushRun();
+    void putVarint(uint64_t v);
+
+    Config _cfg;
+    std::vector<uint8_t> _bytes;
+    std::vector<Block> _blocks;
+    uint64_t _count{0};
+    int64_t _prev{0};
+    int64_t _prevDelta{0};
+    uint64_t _run{0};       // zero delta-of-deltas not yet written
+    size_t _blockLeft{0};   // appends until the next block starts
+};
+
+} // namespace sync
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
+
+#endif // AES_AES11_2009_SYNC_TIE_RECORDER_HPP
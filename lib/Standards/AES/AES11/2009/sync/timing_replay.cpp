@@ -0,0 +1,186 @@
+#include "timing_replay.hpp"
+#include <cmath>
+
+#include "../../../../Common/math/splitmix64.hpp"
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace sync {
+
+SyntheticTimeline::SyntheticTimeline(const Config& cfg) : _cfg(cfg) {
+    if (_cfg.trpDecimation == 0) _cfg.trpDecimation = 1;
+    if (_cfg.ppsPeriodNs == 0) _cfg.pps = false;
+    rewind();
+}
+
+void SyntheticTimeline::rewind() {
+    _rng = _cfg.seed;
+    _nextPpsNs = 0;
+    _state.assign(_cfg.sources.size(), State{0.0, 0, 0, false});
+    for (size_t i = 0; i < _state.size(); ++i) {
+        // A source running frequencyPpm fast has a proportionally shorter TRP period.
+        const double rate = _cfg.sampleRateHz * (1.0 + _cfg.sources[i].frequencyPpm * 1e-6);
+        _state[i].stepNs = rate > 0.0 ? 1e9 * static_cast<double>(_cfg.trpDecimation) / rate : 0.0;
+        _state[i].done = _state[i].stepNs <= 0.0;
+        _state[i].index = 0;
+        if (!_state[i].done) advanceSource(i);
+    }
+}
+
+// Compute the next emitted TRP of source i (skipping its dropout window).
+void SyntheticTimeline::advanceSource(size_t i) {
+    State& st = _state[i];
+    const Source& src = _cfg.sources[i];
+    for (;;) {
+        const double ideal = static_cast<double>(src.phaseOffsetNs) +
+                             static_cast<double>(st.index) * st.stepNs + jitter(src.jitterNs);
+        ++st.index;
+        const uint64_t t = ideal > 0.0 ? static_cast<uint64_t>(std::llround(ideal)) : 0;
+        if (t >= _cfg.durationNs) {
+            st.done = true;
+            return;
+        }
+        if (src.dropoutEndNs > src.dropoutStartNs && t >= src.dropoutStartNs && t < src.dropoutEndNs) {
+            continue;
+        }
+        st.nextNs = t;
+        return;
+    }
+}
+
+// splitmix64 mapped to a uniform value in [-amplitude, amplitude].
+double SyntheticTimeline::jitter(double amplitudeNs) {
+    if (amplitudeNs <= 0.0) return 0.0;
+    return (2.0 * Common::math::splitmix64_unit(_rng) - 1.0) * amplitudeNs;
+}
+
+bool SyntheticTimeline::next(ReplayEvent& ev) {
+    size_t best = _state.size();
+    for (size_t i = 0; i < _state.size(); ++i) {
+        if (!_state[i].done && (best == _state.size() || _state[i].nextNs < _state[best].nextNs)) best = i;
+    }
+    const bool ppsDue = _cfg.pps && _nextPpsNs < _cfg.durationNs;
+    // PPS first on ties so the TRP coincident with an edge resolves that edge.
+    if (ppsDue && (best == _state.size() || _nextPpsNs <= _state[best].nextNs)) {
+        ev = ReplayEvent{ReplayEvent::Kind::Pps, 0, _nextPpsNs};
+        _nextPpsNs += _cfg.ppsPeriodNs;
+        return true;
+    }
+    if (best == _state.size()) return false;
+    ev = ReplayEvent{ReplayEvent::Kind::Trp, static_cast<uint32_t>(best), _state[best].nextNs};
+    advanceSource(best);
+    return true;
+}
+
+TimingReplay::TimingReplay(const Config& cfg)
+    : _cfg(cfg),
+      _expectedIntervalNs(cfg.sampleRateHz > 0.0
+                              ? 1e9 * static_cast<double>(cfg.trpDecimation ? cfg.trpDecimation : 1) /
+                                    cfg.sampleRateHz
+                              : 0.0),
+      _snapshots(_clock),
+      _manager(cfg.hysteresisMargin) {
+    if (_cfg.selectionIntervalNs == 0) _cfg.selectionIntervalNs = 1;
+    _sources.reserve(cfg.sourceCount);
+    for (size_t i = 0; i < cfg.sourceCount; ++i) {
+        _sources.push_back(SourceState{core::TimingWindowProcessor(cfg.windowCapacity, cfg.varianceThresholdNs2),
+                                       0, 0, 0, 0, 0, 0.0, false, false, false, 0});
+    }
+    _metrics.resize(cfg.sourceCount);
+    _report.selected = SynchronizationManager::invalidIndex();
+}
+
+void TimingReplay::process(const ReplayEvent& ev) {
+    _clock.advance_to(ev.timeNs);
+    const core::TimingSnapshot snap = _snapshots.snapshot();
+    const uint64_t t = snap.time_ns;
+    if (!_haveEvent) {
+        _haveEvent = true;
+        _firstEventNs = t;
+        _nextSelectionNs = t + _cfg.selectionIntervalNs;
+    }
+    _lastEventNs = t;
+    if (t >= _nextSelectionNs) {
+        selectSources();
+        // Skip whole intervals without events (e.g., a gap in a recorded timeline).
+        _nextSelectionNs += ((t - _nextSelectionNs) / _cfg.selectionIntervalNs + 1) * _cfg.selectionIntervalNs;
+    }
+    ++_report.events;
+    if (ev.kind == ReplayEvent::Kind::Pps) {
+        ++_report.ppsEvents;
+        onPps(t);
+    } else if (ev.source < _sources.size()) {
+        ++_report.trpEvents;
+        onTrp(_sources[ev.source], t);
+    }
+}
+
+void TimingReplay::onTrp(SourceState& s, uint64_t timeNs) {
+    if (s.ppsPending) resolvePps(s, timeNs);
+    if (s.haveTrp && _expectedIntervalNs > 0.0 && timeNs > s.lastTrpNs) {
+        // Interval error against the nearest whole number of steps: a missed TRP does not
+        // register as a huge interval.
+        const double interval = static_cast<double>(timeNs - s.lastTrpNs);
+        const double steps = std::round(interval / _expectedIntervalNs);
+        if (steps >= 1.0) s.window.addSample(interval - steps * _expectedIntervalNs);
+    }
+    s.lastTrpNs = timeNs;
+    s.haveTrp = true;
+    ++s.trps;
+    ++s.trpsSinceSelection;
+}
+
+void TimingReplay::onPps(uint64_t timeNs) {
+    for (auto& s : _sources) {
+        if (s.ppsPending) {
+            // No TRP since the previous edge: the source could not be aligned to it.
+            ++s.ppsMisaligned;
+            ++_report.ppsMisaligned;
+            s.lastAligned = false;
+        }
+        s.ppsPending = true;
+        s.pendingPpsNs = timeNs;
+    }
+}
+
+// Compare the edge with whichever TRP is nearer: the one before it or trpNs after it.
+void TimingReplay::resolvePps(SourceState& s, uint64_t trpNs) {
+    const uint64_t pps = s.pendingPpsNs;
+    uint64_t nearest = trpNs;
+    if (s.haveTrp && s.lastTrpNs <= pps && pps - s.lastTrpNs < trpNs - pps) nearest = s.lastTrpNs;
+    s.lastPhaseOffsetUs = GPSReferenceSync::phase_offset_us(nearest, pps);
+    s.lastAligned = GPSReferenceSync::within_alignment(nearest, pps, _cfg.ppsToleranceUs);
+    if (s.lastAligned) {
+        ++s.ppsAligned;
+        ++_report.ppsAligned;
+    } else {
+        ++s.ppsMisaligned;
+        ++_report.ppsMisaligned;
+    }
+    s.ppsPending = false;
+}
+
+void TimingReplay::selectSources() {
+    if (_sources.empty()) return;
+    for (size_t i = 0; i < _sources.size(); ++i) {
+        SourceState& s = _sources[i];
+        const core::TimingWindowProcessor::Metrics m = s.window.metrics();
+        const uint64_t checks = s.ppsAligned + s.ppsMisaligned;
+        _metrics[i].stability = m.count ? std::sqrt(m.variance) / 1000.0 : 0.0;
+        _metrics[i].quality = checks ? static_cast<double>(s.ppsAligned) / static_cast<double>(checks) : 1.0;
+        _metrics[i].degraded = s.trpsSinceSelection == 0 || m.count < 2 || !m.stable ||
+                               (checks > 0 && !s.lastAligned);
+        s.trpsSinceSelection = 0;
+    }
+    const size_t previous = _manager.current();
+    const size_t selected = _manager.select(_metrics);
+    ++_report.selections;
+    if (previous != SynchronizationManager::invalidIndex() && selected != previous) ++_report.switches;
+    _report.selected = selected;
+}
+
+} // namespace sync
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
@@ -0,0 +1,218 @@
+/*
+ * Original implementation based on understanding of AES-11-2009 Sections 4.2.4
+ * (GPS-referenced synchronization) and 5.x (timing tolerances). No copyrighted text
+ * is reproduced.
+ */
+
+#ifndef AES_AES11_2009_SYNC_TIMING_REPLAY_HPP
+#define AES_AES11_2009_SYNC_TIMING_REPLAY_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../../../../Common/testing/virtual_clock.hpp"
+#include "../core/timing_snapshot_service.hpp"
+#include "../core/timing_window_processor.hpp"
+#include "gps_reference_sync.hpp"
+#include "synchronization_manager.hpp"
+
+namespace AES {
+namespace AES11 {
+namespace _2009 {
+namespace sync {
+
+/**
+ * @brief One timestamped edge on a replay timeline
+ *
+ * TRP events carry the index of the DARS source they belong to; PPS events are the
+ * GPS 1PPS rising edge shared by all sources (source is ignored).
+ */
+struct ReplayEvent {
+    enum class Kind : uint8_t { Trp, Pps };
+    Kind kind;
+    uint32_t source;
+    uint64_t timeNs;
+};
+
+/**
+ * @brief Recorded timeline: replays a caller-owned, time-ordered event vector
+ */
+class VectorTimeline {
+public:
+    explicit VectorTimeline(const std::vector<ReplayEvent>& events) : _events(events) {}
+
+    bool next(ReplayEvent& ev) {
+        if (_pos >= _events.size()) return false;
+        ev = _events[_pos++];
+        return true;
+    }
+
+    void rewind() { _pos = 0; }
+
+private:
+    const std::vector<ReplayEvent>& _events;
+    size_t _pos{0};
+};
+
+/**
+ * @brief Synthetic timeline: N DARS sources plus optional 1PPS, generated lazily
+ *
+ * Deterministic for a given seed, so a simulated week never needs a week of storage.
+ * Each source emits every trpDecimation-th TRP of a clock running frequencyPpm fast,
+ * with uniform jitter of ±jitterNs (keep below half the TRP step) and no TRPs inside
+ * [dropoutStartNs, dropoutEndNs). For PPS alignment to be meaningful the decimation must
+ * divide the sample rate, so the decimated grid still contains each second.
+ */
+class SyntheticTimeline {
+public:
+    struct Source {
+        double frequencyPpm = 0.0;
+        double jitterNs = 0.0;
+        uint64_t phaseOffsetNs = 0;
+        uint64_t dropoutStartNs = 0;
+        uint64_t dropoutEndNs = 0; // empty dropout when end <= start
+    };
+
+    struct Config {
+        double sampleRateHz = 48000.0;
+        uint32_t trpDecimation = 1;
+        std::vector<Source> sources;
+        bool pps = true;
+        uint64_t ppsPeriodNs = 1'000'000'000ULL;
+        uint64_t durationNs = 1'000'000'000ULL; // events at or after this time are not emitted
+        uint64_t seed = 1;
+    };
+
+    explicit SyntheticTimeline(const Config& cfg);
+
+    bool next(ReplayEvent& ev);
+    void rewind();
+
+private:
+    struct State {
+        double stepNs;
+        uint64_t index;
+        uint64_t nextNs;
+        bool done;
+    };
+
+    void advanceSource(size_t i);
+    double jitter(double amplitudeNs);
+
+    Config _cfg;
+    std::vector<State> _state;
+    uint64_t _nextPpsNs{0};
+    uint64_t _rng{0};
+};
+
+/**
+ * @brief Accelerated replay of TRP/PPS timelines through the synchronization chain
+ *
+ * Every event advances a Common::testing::VirtualClock to the event time and is
+ * timestamped by TimingSnapshotService. Per source, TRP-to-TRP interval errors feed a
+ * core::TimingWindowProcessor (missed TRPs are absorbed by rounding to whole steps),
+ * TRPs nearest each PPS edge are checked with GPSReferenceSync::within_alignment, and
+ * once per selection interval of simulated time the SynchronizationManager selects a
+ * source from:
+ * - stability: interval-error standard deviation in µs;
+ * - quality: fraction of PPS checks within tolerance (1.0 before the first check);
+ * - degraded: no TRP during the interval, window unstable, or last PPS check failed.
+ *
+ * @note Supports soak testing of REQ-F-SYNC-001 and REQ-F-DARS-006 behaviour.
+ */
+class TimingReplay {
+public:
+    struct Config {
+        size_t sourceCount = 1;
+        double sampleRateHz = 48000.0;
+        uint32_t trpDecimation = 1;           // must match the timeline
+        size_t windowCapacity = 32;
+        double varianceThresholdNs2 = 1.0e4;  // interval-error variance for "stable"
+        double hysteresisMargin = 0.1;
+        uint64_t selectionIntervalNs = 1'000'000'000ULL;
+        double ppsToleranceUs = 1.0;
+    };
+
+    struct Report {
+        uint64_t events;
+        uint64_t trpEvents;
+        uint64_t ppsEvents;
+        uint64_t selections;
+        uint64_t switches;       // selection changes after the first selection
+        uint64_t ppsAligned;     // per-source PPS checks within tolerance
+        uint64_t ppsMisaligned;  // per-source PPS checks outside tolerance or missing TRP
+        size_t selected;         // SynchronizationManager::invalidIndex() if never selected
+        uint64_t simulatedNs;    // last minus first event time
+        uint64_t wallNs;
+
+        double simulatedSecondsPerWallSecond() const {
+            return wallNs ? static_cast<double>(simulatedNs) / static_cast<double>(wallNs) : 0.0;
+        }
+    };
+
+    struct SourceState {
+        core::TimingWindowProcessor window;
+        uint64_t lastTrpNs;
+        uint64_t trps;
+        uint64_t trpsSinceSelection;
+        uint64_t ppsAligned;
+        uint64_t ppsMisaligned;
+        double lastPhaseOffsetUs;
+        bool haveTrp;
+        bool lastAligned;
+        bool ppsPending;      // PPS seen, waiting for the TRP after it
+        uint64_t pendingPpsNs;
+    };
+
+    explicit TimingReplay(const Config& cfg);
+
+    // Drain the timeline as fast as possible. Timeline is any type with bool next(ReplayEvent&)
+    // yielding events in non-decreasing time order.
+    template <typename Timeline>
+    Report run(Timeline& timeline) {
+        const auto wall0 = std::chrono::steady_clock::now();
+        ReplayEvent ev{};
+        while (timeline.next(ev)) process(ev);
+        const auto wall1 = std::chrono::steady_clock::now();
+        Report r = _report;
+        r.simulatedNs = _haveEvent ? _lastEventNs - _firstEventNs : 0;
+        r.wallNs = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(wall1 - wall0).count());
+        return r;
+    }
+
+    // Consume one event (run() calls this for every event).
+    void process(const ReplayEvent& ev);
+
+    const SourceState& source(size_t i) const { return _sources[i]; }
+    size_t sourceCount() const { return _sources.size(); }
+    const Common::testing::VirtualClock& clock() const { return _clock; }
+
+private:
+    void onTrp(SourceState& s, uint64_t timeNs);
+    void onPps(uint64_t timeNs);
+    void resolvePps(SourceState& s, uint64_t trpNs);
+    void selectSources();
+
+    Config _cfg;
+    double _expectedIntervalNs;
+    Common::testing::VirtualClock _clock;
+    core::TimingSnapshotService<Common::testing::VirtualClock> _snapshots;
+    SynchronizationManager _manager;
+    std::vector<SourceState> _sources;
+    std::vector<SourceMetrics> _metrics;
+    Report _report{};
+    uint64_t _firstEventNs{0};
+    uint64_t _lastEventNs{0};
+    uint64_t _nextSelectionNs{0};
+    bool _haveEvent{false};
+};
+
+} // namespace sync
+} // namespace _2009
+} // namespace AES11
+} // namespace AES
+
+#endif // AES_AES11_2009_SYNC_TIMING_REPLAY_HPP
@@ -0,0 +1,131 @@
+/*
+Module: lib/Standards/Common/clocks/linux_clocks.hpp
+Phase: 05-implementation
+Traceability:
+    Design: DES-I-002 (Timing Source Interface)
+    Requirements: REQ-NF-PERF-001 (Real-Time Processing Latency)
+    Tests: TEST-UNIT-LinuxClocks
+Notes: Header-only concrete clocks for TimingSnapshotService<Clock>. They are not derived
+       from ClockInterface, so calls inline completely; wrap one in ClockInterfaceAdapter
+       where the virtual interface is required. Linux only (clock_gettime is served by the
+       vDSO for MONOTONIC_RAW and TAI on current kernels); the TSC clock needs x86 and a native 128-bit integer.
+*/
+#ifndef STANDARDS_COMMON_CLOCKS_LINUX_CLOCKS_HPP
+#define STANDARDS_COMMON_CLOCKS_LINUX_CLOCKS_HPP
+
+#include <cstdint>
+
+#include "../interfaces/clock_interface.hpp"
+#include "../math/int128.hpp"
+
+#if defined(__linux__)
+#include <time.h>
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__SIZEOF_INT128__)
+#include <x86intrin.h>
+#define COMMON_CLOCKS_HAVE_TSC 1
+#endif
+#endif
+
+namespace Common {
+namespace clocks {
+
+// Presents any concrete clock through the virtual ClockInterface.
+template <typename Clock>
+class ClockInterfaceAdapter final : public interfaces::ClockInterface {
+public:
+    explicit ClockInterfaceAdapter(Clock& clk) : _clk(clk) {}
+    uint64_t get_tick() override { return _clk.get_tick(); }
+    uint64_t get_time_ns() override { return _clk.get_time_ns(); }
+    interfaces::TickTimePair get_tick_time_pair() override { return interfaces::read_tick_time_pair(_clk); }
+    void get_tick_time_pairs(interfaces::TickTimePair* out, size_t count) override {
+        interfaces::read_tick_time_pairs(_clk, out, count);
+    }
+
+private:
+    Clock& _clk;
+};
+
+#if defined(__linux__)
+
+namespace detail {
+inline uint64_t read_clock_ns(clockid_t id) {
+    timespec ts;
+    clock_gettime(id, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1'000'000'000ULL + static_cast<uint64_t>(ts.tv_nsec);
+}
+} // namespace detail
+
+// CLOCK_MONOTONIC_RAW: hardware rate, not slewed by NTP. Tick equals nanoseconds.
+class MonotonicRawClock {
+public:
+    uint64_t get_tick() { return detail::read_clock_ns(CLOCK_MONOTONIC_RAW); }
+    uint64_t get_time_ns() { return detail::read_clock_ns(CLOCK_MONOTONIC_RAW); }
+    interfaces::TickTimePair get_tick_time_pair() {
+        const uint64_t ns = detail::read_clock_ns(CLOCK_MONOTONIC_RAW);
+        return {ns, ns, 0};
+    }
+};
+
+// CLOCK_TAI: International Atomic Time (requires the kernel TAI offset to be set, e.g. by
+// a PTP daemon; otherwise it equals CLOCK_REALTIME). Tick equals nanoseconds.
+class TaiClock {
+public:
+    uint64_t get_tick() { return detail::read_clock_ns(CLOCK_TAI); }
+    uint64_t get_time_ns() { return detail::read_clock_ns(CLOCK_TAI); }
+    interfaces::TickTimePair get_tick_time_pair() {
+        const uint64_t ns = detail::read_clock_ns(CLOCK_TAI);
+        return {ns, ns, 0};
+    }
+};
+
+#if defined(COMMON_CLOCKS_HAVE_TSC)
+// Invariant TSC. Tick is the raw cycle counter; time is derived with a multiply-shift
+// calibrated once against CLOCK_MONOTONIC_RAW at construction (calibrationNs busy-wait).
+class TscClock {
+public:
+    explicit TscClock(uint64_t calibrationNs = 10'000'000ULL) {
+        const uint64_t ns0 = detail::read_clock_ns(CLOCK_MONOTONIC_RAW);
+        const uint64_t tsc0 = __rdtsc();
+        uint64_t ns1 = ns0;
+        while (ns1 - ns0 < calibrationNs) ns1 = detail::read_clock_ns(CLOCK_MONOTONIC_RAW);
+        const uint64_t tsc1 = __rdtsc();
+        const uint64_t dTsc = tsc1 > tsc0 ? tsc1 - tsc0 : 1;
+        // ns = tsc * mult >> 32
+        _mult = static_cast<uint64_t>((static_cast<math::NativeUInt128>(ns1 - ns0) << kShift) / dTsc);
+        _baseTsc = tsc1;
+        _baseNs = ns1;
+    }
+
+    uint64_t get_tick() { return __rdtsc(); }
+
+    uint64_t get_time_ns() { return to_ns(__rdtsc()); }
+
+    interfaces::TickTimePair get_tick_time_pair() {
+        const uint64_t tsc = __rdtsc();
+        return {tsc, to_ns(tsc), 0};
+    }
+
+    // Cycles on either side of the calibration anchor convert (a tick read just before
+    // calibration, or on a core whose TSC lags slightly, lies before _baseTsc).
+    uint64_t to_ns(uint64_t tsc) const {
+        if (tsc < _baseTsc) return _baseNs - math::mul_shift_u64(_baseTsc - tsc, _mult, kShift);
+        return _baseNs + math::mul_shift_u64(tsc - _baseTsc, _mult, kShift);
+    }
+
+    // Nanoseconds per cycle as a 32.32 fixed-point multiplier.
+    uint64_t multiplier() const { return _mult; }
+
+private:
+    static constexpr unsigned kShift = 32;
+    uint64_t _mult{0};
+    uint64_t _baseTsc{0};
+    uint64_t _baseNs{0};
+};
+#endif // COMMON_CLOCKS_HAVE_TSC
+
+#endif // __linux__
+
+} // namespace clocks
+} // namespace Common
+
+#endif // STANDARDS_COMMON_CLOCKS_LINUX_CLOCKS_HPP
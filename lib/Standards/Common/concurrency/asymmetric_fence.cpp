@@ -0,0 +1,68 @@
+/*
+Module: lib/Standards/Common/concurrency/asymmetric_fence.cpp
+Phase: 05-implementation
+Traceability:
+    Design: DES-C-002 (Synchronization Manager - reference publication)
+    Requirements: REQ-NF-PERF-001 (Real-Time Processing Latency)
+    Tests: TEST-UNIT-AsymmetricFence
+Notes: membarrier backend on Linux; seq_cst fence fallback everywhere else or when the
+       kernel refuses registration (old kernel, seccomp filter).
+*/
+#include "asymmetric_fence.hpp"
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/membarrier.h>)
+#include <linux/membarrier.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#if defined(__NR_membarrier)
+#define COMMON_CONCURRENCY_HAS_MEMBARRIER 1
+#endif
+#endif
+#endif
+
+namespace Common {
+namespace concurrency {
+
+namespace detail {
+std::atomic<bool> g_heavyFenceIsMembarrier{false};
+} // namespace detail
+
+namespace {
+
+bool registerMembarrier() {
+#if defined(COMMON_CONCURRENCY_HAS_MEMBARRIER)
+    const long cmds = syscall(__NR_membarrier, MEMBARRIER_CMD_QUERY, 0);
+    if (cmds < 0 || !(cmds & MEMBARRIER_CMD_PRIVATE_EXPEDITED)) return false;
+    return syscall(__NR_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0) == 0;
+#else
+    return false;
+#endif
+}
+
+} // namespace
+
+bool init_asymmetric_fence() {
+    // Thread-safe one-time registration; the flag is raised only after it succeeded, so
+    // any thread that sees it set is paired with a heavy side that uses membarrier.
+    static const bool registered = [] {
+        const bool ok = registerMembarrier();
+        if (ok) detail::g_heavyFenceIsMembarrier.store(true, std::memory_order_release);
+        return ok;
+    }();
+    return registered;
+}
+
+void heavy_fence() {
+#if defined(COMMON_CONCURRENCY_HAS_MEMBARRIER)
+    if (init_asymmetric_fence()) {
+        // Cannot fail once the process is registered.
+        syscall(__NR_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0);
+        return;
+    }
+#endif
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+} // namespace concurrency
+} // namespace Common
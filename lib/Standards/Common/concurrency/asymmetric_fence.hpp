@@ -0,0 +1,51 @@
+/*
+Module: lib/Standards/Common/concurrency/asymmetric_fence.hpp
+Phase: 05-implementation
+Traceability:
+    Design: DES-C-002 (Synchronization Manager - reference publication)
+    Requirements: REQ-NF-PERF-001 (Real-Time Processing Latency)
+    Tests: TEST-UNIT-AsymmetricFence
+Notes: Store-load fence split between a frequent side and a rare side. light_fence() and
+       heavy_fence() together give the guarantee of a seq_cst fence on both sides: for a
+       thread that stores, light_fence()s and loads, and another that stores,
+       heavy_fence()s and loads, at least one load sees the other thread's store. Where
+       the kernel provides membarrier(MEMBARRIER_CMD_PRIVATE_EXPEDITED) (Linux 4.14+),
+       heavy_fence() makes every running thread of the process execute a full barrier
+       (a system call plus inter-processor interrupts) and light_fence() is only a
+       compiler barrier. Elsewhere both sides are seq_cst fences.
+*/
+#ifndef STANDARDS_COMMON_CONCURRENCY_ASYMMETRIC_FENCE_HPP
+#define STANDARDS_COMMON_CONCURRENCY_ASYMMETRIC_FENCE_HPP
+
+#include <atomic>
+
+namespace Common {
+namespace concurrency {
+
+namespace detail {
+// Set once the process is registered for expedited membarrier; never cleared.
+extern std::atomic<bool> g_heavyFenceIsMembarrier;
+} // namespace detail
+
+// Registers the process for the expedited membarrier (once; later calls are a load).
+// Returns whether heavy_fence() uses it. Called by heavy_fence(); call it early (e.g.
+// at construction of the structure using the fence) so readers take the light path
+// from the start: until registration, light_fence() is a full fence, which is safe.
+bool init_asymmetric_fence();
+
+// Frequent side.
+inline void light_fence() {
+    if (detail::g_heavyFenceIsMembarrier.load(std::memory_order_relaxed)) {
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    } else {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+// Rare side. Costs microseconds with membarrier; a seq_cst fence otherwise.
+void heavy_fence();
+
+} // namespace concurrency
+} // namespace Common
+
+#endif // STANDARDS_COMMON_CONCURRENCY_ASYMMETRIC_FENCE_HPP
@@ -0,0 +1,184 @@
+/*
+Module: lib/Standards/Common/concurrency/epoch_publisher.hpp
+Phase: 05-implementation
+Traceability:
+    Design: DES-C-002 (Synchronization Manager - reference publication)
+    Requirements: REQ-NF-PERF-001 (Real-Time Processing Latency)
+    Tests: TEST-UNIT-EpochPublisher
+Notes: Single-writer/multi-reader publication of immutable values (RCU style). The writer
+       swaps in a freshly allocated value with one atomic exchange; readers pin the value
+       they loaded for the lifetime of a Guard. Replaced values are retired with the epoch
+       of their replacement and freed by the writer once no reader entered at or before
+       that epoch is still inside a Guard. A read is a plain store to the reader's own
+       cache line, a light_fence() and two loads: it never blocks, retries or allocates,
+       and never touches a line the other readers write. The store-load ordering this
+       needs is paid by the writer: reclaim() issues a heavy_fence() (membarrier on
+       Linux) before scanning the slots, so a read has no hardware fence. Without
+       membarrier both sides fall back to a seq_cst fence (one full fence per read).
+       Reader slots are a fixed pool (MaxReaders).
+*/
+#ifndef STANDARDS_COMMON_CONCURRENCY_EPOCH_PUBLISHER_HPP
+#define STANDARDS_COMMON_CONCURRENCY_EPOCH_PUBLISHER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "asymmetric_fence.hpp"
+#include "spsc_ring.hpp" // kCacheLineSize
+
+namespace Common {
+namespace concurrency {
+
+template <typename T, std::size_t MaxReaders = 16>
+class EpochPublisher {
+    struct alignas(kCacheLineSize) Slot {
+        std::atomic<uint64_t> epoch{0}; // 0: not inside a Guard
+        std::atomic<bool> claimed{false};
+    };
+
+public:
+    // Pins the value current when it was taken; release before the next read on the
+    // same Reader (guards do not nest).
+    class Guard {
+    public:
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+        Guard(Guard&& other) noexcept : _slot(other._slot), _value(other._value) { other._slot = nullptr; }
+        ~Guard() {
+            if (_slot) _slot->epoch.store(0, std::memory_order_release);
+        }
+
+        const T& operator*() const { return *_value; }
+        const T* operator->() const { return _value; }
+        const T* get() const { return _value; }
+
+    private:
+        friend class EpochPublisher;
+        Guard(Slot* slot, const T* value) : _slot(slot), _value(value) {}
+
+        Slot* _slot;
+        const T* _value;
+    };
+
+    // One per reading thread; returns its slot to the pool on destruction.
+    class Reader {
+    public:
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+        Reader(Reader&& other) noexcept : _owner(other._owner), _slot(other._slot) { other._slot = nullptr; }
+        ~Reader() {
+            if (_slot) _slot->claimed.store(false, std::memory_order_release);
+        }
+
+        // False when the pool was exhausted at registration; read() must not be called.
+        bool valid() const { return _slot != nullptr; }
+
+        Guard read() const {
+            // Announce, then load the pointer. light_fence() pairs with the heavy_fence()
+            // in reclaim(): either this load sees the writer's exchange or the writer's
+            // scan sees this announcement.
+            _slot->epoch.store(_owner->_epoch.load(std::memory_order_acquire), std::memory_order_relaxed);
+            light_fence();
+            return Guard(_slot, _owner->_current.load(std::memory_order_acquire));
+        }
+
+        // Copy of the current value without holding a Guard.
+        T load() const {
+            const Guard g = read();
+            return *g;
+        }
+
+    private:
+        friend class EpochPublisher;
+        Reader(const EpochPublisher* owner, Slot* slot) : _owner(owner), _slot(slot) {}
+
+        const EpochPublisher* _owner;
+        Slot* _slot;
+    };
+
+    explicit EpochPublisher(const T& initial = T{}) : _current(new T(initial)) { init_asymmetric_fence(); }
+
+    EpochPublisher(const EpochPublisher&) = delete;
+    EpochPublisher& operator=(const EpochPublisher&) = delete;
+
+    // Requires that no Reader or Guard outlives the publisher.
+    ~EpochPublisher() {
+        delete _current.load(std::memory_order_relaxed);
+        for (auto& r : _retired) delete r.value;
+    }
+
+    // Any thread; lock-free claim of a free slot.
+    Reader register_reader() const {
+        for (auto& s : _slots) {
+            bool expected = false;
+            if (!s.claimed.load(std::memory_order_relaxed) &&
+                s.claimed.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                s.epoch.store(0, std::memory_order_relaxed);
+                return Reader(this, &s);
+            }
+        }
+        return Reader(this, nullptr);
+    }
+
+    // Writer side (single writer). Allocates the new value, then frees whatever retired
+    // values no reader can still hold.
+    void publish(const T& value) { swap_in(new T(value)); }
+    void publish(T&& value) { swap_in(new T(std::move(value))); }
+
+    // Writer side: frees retired values whose readers have all left. Returns the number
+    // still pending (non-zero only while some Guard taken before their replacement lives).
+    std::size_t reclaim() {
+        if (_retired.empty()) return 0;
+        heavy_fence(); // orders the exchange in swap_in() before the scan, for every reader
+        uint64_t oldest = ~uint64_t{0};
+        for (const auto& s : _slots) {
+            const uint64_t e = s.epoch.load(std::memory_order_acquire);
+            if (e != 0 && e < oldest) oldest = e;
+        }
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < _retired.size(); ++i) {
+            // A reader that announced epoch <= retiredAt may have loaded the old pointer.
+            if (oldest <= _retired[i].retiredAt) {
+                _retired[kept++] = _retired[i];
+            } else {
+                delete _retired[i].value;
+            }
+        }
+        _retired.resize(kept);
+        return kept;
+    }
+
+    // Writer side: the value the writer last published (no Guard needed on the writer).
+    const T& current() const { return *_current.load(std::memory_order_relaxed); }
+
+    uint64_t epoch() const { return _epoch.load(std::memory_order_acquire); }
+    std::size_t retired() const { return _retired.size(); }
+    static constexpr std::size_t max_readers() { return MaxReaders; }
+
+private:
+    struct Retired {
+        const T* value;
+        uint64_t retiredAt;
+    };
+
+    void swap_in(const T* next) {
+        const T* old = _current.exchange(next, std::memory_order_seq_cst);
+        const uint64_t e = _epoch.load(std::memory_order_relaxed);
+        _retired.push_back(Retired{old, e});
+        _epoch.store(e + 1, std::memory_order_seq_cst);
+        reclaim();
+    }
+
+    std::atomic<const T*> _current;
+    alignas(kCacheLineSize) std::atomic<uint64_t> _epoch{1};
+    mutable Slot _slots[MaxReaders];
+    std::vector<Retired> _retired; // writer-owned
+};
+
+} // namespace concurrency
+} // namespace Common
+
+#endif // STANDARDS_COMMON_CONCURRENCY_EPOCH_PUBLISHER_HPP
@@ -0,0 +1,70 @@
+/*
+Module: lib/Standards/Common/concurrency/seqlock.hpp
+Phase: 05-implementation
+Traceability:
+    Design: DES-I-002 (Timing Source Interface - tick conversion publication)
+    Requirements: REQ-NF-PERF-001 (Real-Time Processing Latency)
+    Tests: TEST-UNIT-Seqlock
+Notes: Single-writer sequence lock for small trivially copyable values. Readers never
+       block the writer and retry only if a store overlapped their read. Payload words are
+       relaxed atomics so concurrent access is free of data races.
+*/
+#ifndef STANDARDS_COMMON_CONCURRENCY_SEQLOCK_HPP
+#define STANDARDS_COMMON_CONCURRENCY_SEQLOCK_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace Common {
+namespace concurrency {
+
+template <typename T>
+class Seqlock {
+    static_assert(std::is_trivially_copyable<T>::value, "Seqlock payload must be trivially copyable");
+
+public:
+    Seqlock() { store(T{}); }
+    explicit Seqlock(const T& initial) { store(initial); }
+
+    // Writer side (single writer).
+    void store(const T& value) {
+        uint64_t words[kWords] = {};
+        std::memcpy(words, &value, sizeof(T));
+        const uint64_t s = _seq.load(std::memory_order_relaxed);
+        _seq.store(s + 1, std::memory_order_relaxed); // odd: write in progress
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < kWords; ++i) _words[i].store(words[i], std::memory_order_relaxed);
+        _seq.store(s + 2, std::memory_order_release);
+    }
+
+    // Reader side (any thread); retries while a write overlaps.
+    T load() const {
+        uint64_t words[kWords];
+        uint64_t s0, s1;
+        do {
+            s0 = _seq.load(std::memory_order_acquire);
+            for (size_t i = 0; i < kWords; ++i) words[i] = _words[i].load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            s1 = _seq.load(std::memory_order_relaxed);
+        } while ((s0 & 1u) != 0 || s0 != s1);
+        T out;
+        std::memcpy(&out, words, sizeof(T));
+        return out;
+    }
+
+    // Number of completed stores.
+    uint64_t version() const { return _seq.load(std::memory_order_acquire) / 2; }
+
+private:
+    static constexpr size_t kWords = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    std::atomic<uint64_t> _seq{0};
+    std::atomic<uint64_t> _words[kWords];
+};
+
+} // namespace concurrency
+} // namespace Common
+
+#endif // STANDARDS_COMMON_CONCURRENCY_SEQLOCK_HPP
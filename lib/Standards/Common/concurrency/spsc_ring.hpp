@@ -0,0 +1,106 @@
+/*
+Module: lib/Standards/Common/concurrency/spsc_ring.hpp
+Phase: 05-implementation
+Traceability:
+    Design: DES-C-003 (Timing Window Processor - real-time ingestion)
+    Requirements: REQ-NF-PERF-001 (Real-Time Processing Latency)
+    Tests: TEST-UNIT-SpscRing
+Notes: Wait-free single-producer/single-consumer ring. Storage is allocated once at
+       construction; push/pop never allocate, lock or loop. Capacity is rounded up to
+       a power of two so index wrap is a mask.
+*/
+#ifndef STANDARDS_COMMON_CONCURRENCY_SPSC_RING_HPP
+#define STANDARDS_COMMON_CONCURRENCY_SPSC_RING_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace Common {
+namespace concurrency {
+
+// Fixed at 64 bytes: std::hardware_destructive_interference_size is not
+// uniformly available across the toolchains this repo targets.
+constexpr std::size_t kCacheLineSize = 64;
+
+template <typename T>
+class SpscRing {
+public:
+    explicit SpscRing(std::size_t minCapacity)
+        : _capacity(roundUpPow2(minCapacity)), _mask(_capacity - 1),
+          _buffer(new T[_capacity]) {}
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    // Producer side. Returns false (and leaves the ring unchanged) when full.
+    bool try_push(const T& value) noexcept {
+        const std::size_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail - _cachedHead == _capacity) {
+            _cachedHead = _head.load(std::memory_order_acquire);
+            if (tail - _cachedHead == _capacity) return false;
+        }
+        _buffer[tail & _mask] = value;
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. Returns false when empty.
+    bool try_pop(T& out) noexcept {
+        const std::size_t head = _head.load(std::memory_order_relaxed);
+        if (head == _cachedTail) {
+            _cachedTail = _tail.load(std::memory_order_acquire);
+            if (head == _cachedTail) return false;
+        }
+        out = _buffer[head & _mask];
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. Hands up to maxItems queued elements to sink in FIFO order and
+    // publishes the consumed range with a single release store.
+    template <typename Sink>
+    std::size_t drain(Sink&& sink, std::size_t maxItems = static_cast<std::size_t>(-1)) {
+        const std::size_t head = _head.load(std::memory_order_relaxed);
+        _cachedTail = _tail.load(std::memory_order_acquire);
+        std::size_t avail = _cachedTail - head;
+        if (avail > maxItems) avail = maxItems;
+        for (std::size_t i = 0; i < avail; ++i) {
+            sink(_buffer[(head + i) & _mask]);
+        }
+        _head.store(head + avail, std::memory_order_release);
+        return avail;
+    }
+
+    // Approximate occupancy; exact only when called from a quiescent state.
+    std::size_t size_approx() const noexcept {
+        const std::size_t tail = _tail.load(std::memory_order_acquire);
+        const std::size_t head = _head.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    std::size_t capacity() const noexcept { return _capacity; }
+
+private:
+    static std::size_t roundUpPow2(std::size_t n) {
+        std::size_t c = 1;
+        while (c < n) c <<= 1;
+        return c;
+    }
+
+    // Consumer-owned line: head index plus the consumer's cached view of tail.
+    alignas(kCacheLineSize) std::atomic<std::size_t> _head{0};
+    std::size_t _cachedTail{0};
+    // Producer-owned line: tail index plus the producer's cached view of head.
+    alignas(kCacheLineSize) std::atomic<std::size_t> _tail{0};
+    std::size_t _cachedHead{0};
+    // Read-only after construction.
+    alignas(kCacheLineSize) const std::size_t _capacity;
+    const std::size_t _mask;
+    std::unique_ptr<T[]> _buffer;
+};
+
+} // namespace concurrency
+} // namespace Common
+
+#endif // STANDARDS_COMMON_CONCURRENCY_SPSC_RING_HPP
@@ -4,11 +4,41 @@
 #ifndef COMMON_INTERFACES_CLOCK_INTERFACE_HPP
 #define COMMON_INTERFACES_CLOCK_INTERFACE_HPP
 
+#include <cstddef>
 #include <cstdint>
+#include <type_traits>
+#include <utility>
 
 namespace Common {
 namespace interfaces {
 
+// Tick and time captured as one pair. The tick that corresponds to time_ns lies within
+// tick ± uncertainty_ticks (0 when the backend derives both from a single read).
+struct TickTimePair {
+    uint64_t tick;
+    uint64_t time_ns;
+    uint64_t uncertainty_ticks;
+};
+
+// Fallback pairing for clocks without a native paired read: bracket the time read with
+// two tick reads (tick, time, tick), retry a few times and keep the tightest bracket.
+template <typename Clock>
+TickTimePair bracket_tick_time(Clock& clk, unsigned attempts = 3) {
+    TickTimePair best{0, 0, ~uint64_t{0}};
+    for (unsigned i = 0; i < attempts; ++i) {
+        const uint64_t t0 = clk.get_tick();
+        const uint64_t ns = clk.get_time_ns();
+        const uint64_t t1 = clk.get_tick();
+        const uint64_t width = t1 - t0;
+        const uint64_t half = (width + 1) / 2;
+        if (half < best.uncertainty_ticks) {
+            best = TickTimePair{t0 + width / 2, ns, half};
+        }
+        if (width <= 1) break; // cannot get tighter with a discrete tick
+    }
+    return best;
+}
+
 class ClockInterface {
 public:
     virtual ~ClockInterface() = default;
@@ -16,8 +46,54 @@ public:
     virtual uint64_t get_tick() = 0;
     // Return current time in nanoseconds from arbitrary but stable epoch
     virtual uint64_t get_time_ns() = 0;
+    // Return tick and time captured together. Backends that can derive both from one
+    // hardware read should override; the default brackets separate reads.
+    virtual TickTimePair get_tick_time_pair() { return bracket_tick_time(*this); }
+    // Fill out[0..count) with successive paired reads. The default issues one virtual
+    // get_tick_time_pair() per element; only backends that override this method (shared
+    // register read, vector conversion) reduce a batch to a single virtual call.
+    virtual void get_tick_time_pairs(TickTimePair* out, size_t count) {
+        for (size_t i = 0; i < count; ++i) out[i] = get_tick_time_pair();
+    }
 };
 
+namespace detail {
+template <typename Clock, typename = void>
+struct has_tick_time_pair : std::false_type {};
+template <typename Clock>
+struct has_tick_time_pair<Clock, decltype(void(std::declval<Clock&>().get_tick_time_pair()))>
+    : std::true_type {};
+
+template <typename Clock, typename = void>
+struct has_tick_time_pairs : std::false_type {};
+template <typename Clock>
+struct has_tick_time_pairs<Clock, decltype(void(std::declval<Clock&>().get_tick_time_pairs(
+                                      std::declval<TickTimePair*>(), size_t{})))>
+    : std::true_type {};
+} // namespace detail
+
+// Paired read for any clock type: native get_tick_time_pair() when provided (including
+// ClockInterface and its overrides), otherwise the bracketing fallback.
+template <typename Clock>
+TickTimePair read_tick_time_pair(Clock& clk) {
+    if constexpr (detail::has_tick_time_pair<Clock>::value) {
+        return clk.get_tick_time_pair();
+    } else {
+        return bracket_tick_time(clk);
+    }
+}
+
+// Batched paired reads: native get_tick_time_pairs() when provided, otherwise one
+// read_tick_time_pair() per element (inlined for concrete clocks).
+template <typename Clock>
+void read_tick_time_pairs(Clock& clk, TickTimePair* out, size_t count) {
+    if constexpr (detail::has_tick_time_pairs<Clock>::value) {
+        clk.get_tick_time_pairs(out, count);
+    } else {
+        for (size_t i = 0; i < count; ++i) out[i] = read_tick_time_pair(clk);
+    }
+}
+
 } // namespace interfaces
 } // namespace Common
 
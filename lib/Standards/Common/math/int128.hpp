@@ -0,0 +1,116 @@
+/*
+Module: lib/Standards/Common/math/int128.hpp
+Phase: 05-implementation
+Traceability:
+    Design: DES-C-003 (Timing Window Processor - exact integer aggregates)
+    Requirements: REQ-NF-PERF-003 (Timing Accuracy and Jitter)
+    Tests: TEST-UNIT-Int128
+Notes: Minimal portable signed 128-bit integer (two's complement, hi/lo words) for exact
+       sums of squares. Compiler-native __int128 is not available on MSVC, so this type is
+       used on every toolchain to keep results identical across CI platforms (the
+       mul_shift_u64 helper may use __int128 because its result is identical). Only the
+       operations needed by fixed-point statistics are provided; overflow wraps.
+*/
+#ifndef STANDARDS_COMMON_MATH_INT128_HPP
+#define STANDARDS_COMMON_MATH_INT128_HPP
+
+#include <cstdint>
+
+namespace Common {
+namespace math {
+
+struct Int128 {
+    uint64_t lo{0};
+    int64_t hi{0};
+
+    constexpr Int128() = default;
+    constexpr Int128(int64_t v) : lo(static_cast<uint64_t>(v)), hi(v < 0 ? -1 : 0) {} // NOLINT implicit
+    constexpr Int128(int64_t h, uint64_t l) : lo(l), hi(h) {}
+
+    // Exact 64x64 -> 128 signed product.
+    static Int128 mul(int64_t a, int64_t b) {
+        const bool neg = (a < 0) != (b < 0);
+        Int128 r = mulu(uabs(a), uabs(b));
+        return neg ? -r : r;
+    }
+
+    friend Int128 operator+(Int128 a, Int128 b) {
+        const uint64_t lo = a.lo + b.lo;
+        const uint64_t carry = lo < a.lo ? 1u : 0u;
+        return Int128(static_cast<int64_t>(static_cast<uint64_t>(a.hi) + static_cast<uint64_t>(b.hi) + carry), lo);
+    }
+    friend Int128 operator-(Int128 a) {
+        const uint64_t lo = ~a.lo + 1u;
+        const uint64_t hi = ~static_cast<uint64_t>(a.hi) + (lo == 0 ? 1u : 0u);
+        return Int128(static_cast<int64_t>(hi), lo);
+    }
+    friend Int128 operator-(Int128 a, Int128 b) { return a + (-b); }
+    Int128& operator+=(Int128 o) { return *this = *this + o; }
+    Int128& operator-=(Int128 o) { return *this = *this - o; }
+
+    // Truncating 128x64 product (caller guarantees the result fits).
+    friend Int128 operator*(Int128 a, int64_t b) {
+        const bool neg = (a.hi < 0) != (b < 0);
+        const Int128 ua = a.hi < 0 ? -a : a;
+        const uint64_t ub = uabs(b);
+        Int128 r = mulu(ua.lo, ub);
+        r.hi = static_cast<int64_t>(static_cast<uint64_t>(r.hi) + static_cast<uint64_t>(ua.hi) * ub);
+        return neg ? -r : r;
+    }
+
+    friend bool operator==(Int128 a, Int128 b) { return a.hi == b.hi && a.lo == b.lo; }
+    friend bool operator!=(Int128 a, Int128 b) { return !(a == b); }
+    friend bool operator<(Int128 a, Int128 b) { return a.hi != b.hi ? a.hi < b.hi : a.lo < b.lo; }
+    friend bool operator>(Int128 a, Int128 b) { return b < a; }
+    friend bool operator<=(Int128 a, Int128 b) { return !(b < a); }
+    friend bool operator>=(Int128 a, Int128 b) { return !(a < b); }
+
+    double to_double() const {
+        return static_cast<double>(hi) * 18446744073709551616.0 + static_cast<double>(lo);
+    }
+
+private:
+    static uint64_t uabs(int64_t v) {
+        return v < 0 ? ~static_cast<uint64_t>(v) + 1u : static_cast<uint64_t>(v);
+    }
+
+    // Unsigned 64x64 -> 128 via 32-bit limbs (portable, no intrinsics).
+    static Int128 mulu(uint64_t a, uint64_t b) {
+        const uint64_t aL = a & 0xFFFFFFFFu, aH = a >> 32;
+        const uint64_t bL = b & 0xFFFFFFFFu, bH = b >> 32;
+        const uint64_t ll = aL * bL;
+        const uint64_t lh = aL * bH;
+        const uint64_t hl = aH * bL;
+        const uint64_t hh = aH * bH;
+        const uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFFu) + (hl & 0xFFFFFFFFu);
+        const uint64_t lo = (mid << 32) | (ll & 0xFFFFFFFFu);
+        const uint64_t hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+        return Int128(static_cast<int64_t>(hi), lo);
+    }
+};
+
+#if defined(__SIZEOF_INT128__)
+// __extension__ keeps -Wpedantic quiet in every TU that includes this header.
+__extension__ typedef unsigned __int128 NativeUInt128;
+#endif
+
+// (a * b) >> shift using the full 128-bit product; shift must be < 64. Used for
+// fixed-point multiply-shift conversions where the product may exceed 64 bits.
+inline uint64_t mul_shift_u64(uint64_t a, uint64_t b, unsigned shift) {
+#if defined(__SIZEOF_INT128__)
+    return static_cast<uint64_t>((static_cast<NativeUInt128>(a) * b) >> shift);
+#else
+    const uint64_t aL = a & 0xFFFFFFFFu, aH = a >> 32;
+    const uint64_t bL = b & 0xFFFFFFFFu, bH = b >> 32;
+    const uint64_t ll = aL * bL, lh = aL * bH, hl = aH * bL, hh = aH * bH;
+    const uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFFu) + (hl & 0xFFFFFFFFu);
+    const uint64_t lo = (mid << 32) | (ll & 0xFFFFFFFFu);
+    const uint64_t hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    return shift == 0 ? lo : (lo >> shift) | (hi << (64 - shift));
+#endif
+}
+
+} // namespace math
+} // namespace Common
+
+#endif // STANDARDS_COMMON_MATH_INT128_HPP
@@ -0,0 +1,35 @@
+/*
+Module: lib/Standards/Common/math/splitmix64.hpp
+Phase: 05-implementation
+Traceability:
+    Design: DES-C-002 (Synchronization Manager - simulation and replay inputs)
+    Requirements: REQ-NF-REL-004
+    Tests: TEST-SYNC-SIM, TEST-TIMESRC-REPLAY
+Notes: splitmix64 generator shared by the synthetic timelines and switching simulations.
+       Deterministic for a given seed on every platform, so recorded runs replay exactly.
+*/
+#ifndef STANDARDS_COMMON_MATH_SPLITMIX64_HPP
+#define STANDARDS_COMMON_MATH_SPLITMIX64_HPP
+
+#include <cstdint>
+
+namespace Common {
+namespace math {
+
+// Advances state and returns the next 64-bit output.
+inline uint64_t splitmix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Next output as a uniform double in [0, 1) (top 53 bits).
+inline double splitmix64_unit(uint64_t& state) {
+    return static_cast<double>(splitmix64(state) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+} // namespace math
+} // namespace Common
+
+#endif // STANDARDS_COMMON_MATH_SPLITMIX64_HPP
@@ -18,6 +18,9 @@ static std::atomic<uint64_t> g_utcFailures{0};
 static std::atomic<uint64_t> g_dateTimeFailures{0};
 static std::atomic<uint64_t> g_leapSecondFailures{0};
 static std::atomic<uint64_t> g_timezoneFailures{0};
+static std::atomic<uint64_t> g_timingOutliers{0};
+static std::atomic<uint64_t> g_sourceFailovers{0};
+static std::atomic<uint64_t> g_maxFailoverLatencyNs{0};
 
 void ReliabilityMetrics::incrementUtcFailure() {
     g_utcFailures.fetch_add(1, std::memory_order_relaxed);
@@ -39,12 +42,29 @@ void ReliabilityMetrics::incrementTimezoneFailure() {
     emit_event({"timezone_failure", 1, nullptr});
 }
 
+void ReliabilityMetrics::incrementTimingOutlier() {
+    g_timingOutliers.fetch_add(1, std::memory_order_relaxed);
+    emit_event({"timing_outlier", 1, nullptr});
+}
+
+void ReliabilityMetrics::incrementSourceFailover(uint64_t latencyNs) {
+    g_sourceFailovers.fetch_add(1, std::memory_order_relaxed);
+    uint64_t prev = g_maxFailoverLatencyNs.load(std::memory_order_relaxed);
+    while (latencyNs > prev &&
+           !g_maxFailoverLatencyNs.compare_exchange_weak(prev, latencyNs, std::memory_order_relaxed)) {
+    }
+    emit_event({"source_failover", latencyNs, nullptr});
+}
+
 MetricsSnapshot ReliabilityMetrics::snapshot() {
     MetricsSnapshot s{};
     s.utcFailures = g_utcFailures.load(std::memory_order_relaxed);
     s.dateTimeFailures = g_dateTimeFailures.load(std::memory_order_relaxed);
     s.leapSecondFailures = g_leapSecondFailures.load(std::memory_order_relaxed);
     s.timezoneFailures = g_timezoneFailures.load(std::memory_order_relaxed);
+    s.timingOutliers = g_timingOutliers.load(std::memory_order_relaxed);
+    s.sourceFailovers = g_sourceFailovers.load(std::memory_order_relaxed);
+    s.maxFailoverLatencyNs = g_maxFailoverLatencyNs.load(std::memory_order_relaxed);
     return s;
 }
 
@@ -53,6 +73,9 @@ void ReliabilityMetrics::resetForTesting() {
     g_dateTimeFailures.store(0, std::memory_order_relaxed);
     g_leapSecondFailures.store(0, std::memory_order_relaxed);
     g_timezoneFailures.store(0, std::memory_order_relaxed);
+    g_timingOutliers.store(0, std::memory_order_relaxed);
+    g_sourceFailovers.store(0, std::memory_order_relaxed);
+    g_maxFailoverLatencyNs.store(0, std::memory_order_relaxed);
 }
 
 } // namespace reliability
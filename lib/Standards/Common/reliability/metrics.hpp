@@ -20,6 +20,9 @@ struct MetricsSnapshot {
     uint64_t dateTimeFailures{0};
     uint64_t leapSecondFailures{0};
     uint64_t timezoneFailures{0};
+    uint64_t timingOutliers{0};
+    uint64_t sourceFailovers{0};
+    uint64_t maxFailoverLatencyNs{0};
 };
 
 class ReliabilityMetrics {
@@ -29,6 +32,8 @@ public:
     static void incrementDateTimeFailure();
     static void incrementLeapSecondFailure();
     static void incrementTimezoneFailure();
+    static void incrementTimingOutlier();
+    static void incrementSourceFailover(uint64_t latencyNs);
 
     // Return current values (non-resetting)
     static MetricsSnapshot snapshot();
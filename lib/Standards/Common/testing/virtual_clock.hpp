@@ -0,0 +1,66 @@
+/*
+Module: lib/Standards/Common/testing/virtual_clock.hpp
+Phase: 05-implementation
+Traceability:
+  Design: DES-I-002 (Timing Source Interface), DES-C-004 (Test hooks)
+  Requirements: REQ-NF-REL-004
+  Tests: TEST-UNIT-TimingReplay
+Notes: Deterministic clock whose time only moves when the driver advances it, so soak
+       scenarios run as fast as the CPU allows. Concrete type (not derived from
+       ClockInterface) for TimingSnapshotService<Clock>; wrap it in
+       Common::clocks::ClockInterfaceAdapter where the virtual interface is required.
+       Single writer (the driver); any thread may read.
+*/
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "../interfaces/clock_interface.hpp"
+
+namespace Common {
+namespace testing {
+
+class VirtualClock {
+public:
+    // ticksPerNs models a counter faster than 1 GHz (e.g., 3 for a 3 GHz TSC).
+    explicit VirtualClock(uint64_t startNs = 0, uint64_t ticksPerNs = 1)
+        : _nowNs(startNs), _ticksPerNs(ticksPerNs ? ticksPerNs : 1) {}
+
+    uint64_t get_tick() { return now_ns() * _ticksPerNs; }
+    uint64_t get_time_ns() { return now_ns(); }
+
+    // Both values derive from one read: exact pair.
+    interfaces::TickTimePair get_tick_time_pair() {
+        const uint64_t ns = now_ns();
+        return interfaces::TickTimePair{ns * _ticksPerNs, ns, 0};
+    }
+
+    // A burst read between two advances sees one instant: load once, fill all.
+    void get_tick_time_pairs(interfaces::TickTimePair* out, size_t count) {
+        const interfaces::TickTimePair p = get_tick_time_pair();
+        for (size_t i = 0; i < count; ++i) out[i] = p;
+    }
+
+    // Move time forward to timeNs; earlier values are ignored (time stays monotonic).
+    void advance_to(uint64_t timeNs) {
+        if (timeNs > _nowNs.load(std::memory_order_relaxed)) {
+            _nowNs.store(timeNs, std::memory_order_release);
+        }
+    }
+
+    void advance_by(uint64_t deltaNs) {
+        _nowNs.store(_nowNs.load(std::memory_order_relaxed) + deltaNs, std::memory_order_release);
+    }
+
+    uint64_t now_ns() const { return _nowNs.load(std::memory_order_acquire); }
+    uint64_t ticks_per_ns() const { return _ticksPerNs; }
+
+private:
+    std::atomic<uint64_t> _nowNs;
+    uint64_t _ticksPerNs;
+};
+
+} // namespace testing
+} // namespace Common
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include "../../lib/Standards/AES/AES11/2009/core/frame_phase.hpp"
+#include "../../lib/Standards/AES/AES11/2009/core/phase_tolerance.hpp"
+
+#include <cmath>
+#include <random>
+
+using AES::AES11::_2009::core::FramePhase;
+using AES::AES11::_2009::core::PhaseOffset;
+using AES::AES11::_2009::core::PhaseTolerance;
+
+namespace {
+
+// Reference (n * 2^32) mod period by shift-and-subtract.
+uint64_t referenceReduce(uint64_t n, uint64_t period) {
+    uint64_t r = n % period;
+    for (int i = 0; i < 32; ++i) {
+        r <<= 1;
+        if (r >= period) r -= period;
+    }
+    return r;
+}
+
+int64_t referenceOffset(uint64_t t, uint64_t ref, uint64_t period) {
+    const bool negative = t < ref;
+    const uint64_t r = referenceReduce(negative ? ref - t : t - ref, period);
+    const int64_t v = r > period / 2 ? static_cast<int64_t>(r) - static_cast<int64_t>(period)
+                                     : static_cast<int64_t>(r);
+    return negative ? -v : v;
+}
+
+} // namespace
+
+// Verifies: REQ-F-DARS-004
+// TEST-FRAME-PHASE-001: Offsets wrap to the nearest frame (20.8 us at 48 kHz is ~0)
+TEST(FramePhaseTests, WrapsToNearestFrame48k) {
+    const FramePhase fp(48000.0);
+    ASSERT_TRUE(fp.valid());
+    EXPECT_NEAR(fp.period_ns(), 1e9 / 48000.0, 1e-9);
+
+    const uint64_t ref = 5'000'000'000ULL;
+    // Three frames are exactly 62500 ns: in phase (up to the rounding of the Q32 period).
+    EXPECT_LE(fp.offset(ref + 62'500, ref).abs_q32(), 2u);
+    EXPECT_LE(fp.offset(ref - 62'500, ref).abs_q32(), 2u);
+    // One frame late by 2/3 ns, one frame early by the same.
+    EXPECT_NEAR(fp.offset(ref + 20'834, ref).ns(), 2.0 / 3.0, 1e-6);
+    EXPECT_NEAR(fp.offset(ref - 20'834, ref).ns(), -2.0 / 3.0, 1e-6);
+    EXPECT_TRUE(fp.within_output(fp.offset(ref + 20'834, ref)));
+
+    // Half a frame is 10416.67 ns: just below stays positive, just above wraps negative.
+    EXPECT_NEAR(fp.offset(ref + 10'416, ref).ns(), 10'416.0, 1e-6);
+    EXPECT_NEAR(fp.offset(ref + 10'417, ref).ns(), 10'417.0 - 1e9 / 48000.0, 1e-6);
+    EXPECT_LE(fp.offset(ref + 10'417, ref).abs_q32(), fp.period_q32() / 2);
+
+    // Position on the grid anchored at t = 0.
+    EXPECT_LT(std::ldexp(static_cast<double>(fp.phase_q32(62'500ULL * 1'000'000)), -32), 1e-3);
+    EXPECT_NEAR(std::ldexp(static_cast<double>(fp.phase_q32(20'834)), -32), 2.0 / 3.0, 1e-6);
+}
+
+// Verifies: REQ-F-DARS-004
+// TEST-FRAME-PHASE-002: Reciprocal reduction is exact over the full timestamp range
+TEST(FramePhaseTests, MatchesExactReductionAcrossRates) {
+    std::mt19937_64 rng(48);
+    for (double rate : {8000.0, 32000.0, 44100.0, 48000.0, 96000.0, 192000.0, 384000.0,
+                        48000.0 * 1000.0 / 1001.0, 44100.0 * 1001.0 / 1000.0}) {
+        const FramePhase fp(rate);
+        ASSERT_TRUE(fp.valid()) << rate;
+        const uint64_t period = fp.period_q32();
+        for (int i = 0; i < 20'000; ++i) {
+            uint64_t a = rng(), b = rng();
+            if (i % 4 == 1) b = a + (rng() >> 40);          // near pairs, either order
+            if (i % 4 == 2) b = a - (rng() >> 40);
+            if (i % 4 == 3) { a >>= 20; b >>= 20; }        // realistic uptimes
+            ASSERT_EQ(fp.offset(a, b).q32, referenceOffset(a, b, period)) << rate << " " << a << " " << b;
+            ASSERT_EQ(fp.phase_q32(a), referenceReduce(a, period)) << rate << " " << a;
+        }
+        // Extremes of the unsigned range.
+        EXPECT_EQ(fp.offset(~uint64_t{0}, 0).q32, referenceOffset(~uint64_t{0}, 0, period));
+        EXPECT_EQ(fp.offset(0, ~uint64_t{0}).q32, referenceOffset(0, ~uint64_t{0}, period));
+    }
+}
+
+// Verifies: REQ-F-DARS-004
+// TEST-FRAME-PHASE-003: Integer bands agree with PhaseTolerance (to the ps, since AES5
+// rates use the rounded ps table)
+TEST(FramePhaseTests, TolerancesMatchPhaseTolerance) {
+    for (double rate : {32000.0, 44100.0, 48000.0, 96000.0}) {
+        const FramePhase fp(rate);
+        const double outNs = std::round(PhaseTolerance::output_tolerance_us(rate) * 1e6) / 1000.0;
+        const double inNs = std::round(PhaseTolerance::input_tolerance_us(rate) * 1e6) / 1000.0;
+        const double warnNs = PhaseTolerance::output_warning_threshold_us(rate) * 1000.0;
+
+        EXPECT_TRUE(fp.within_output(PhaseOffset::from_ns(outNs)));
+        EXPECT_TRUE(fp.within_output(PhaseOffset::from_ns(-outNs)));
+        EXPECT_FALSE(fp.within_output(PhaseOffset::from_ns(outNs * 1.01)));
+        EXPECT_TRUE(fp.within_input(PhaseOffset::from_ns(-inNs)));
+        EXPECT_FALSE(fp.within_input(PhaseOffset::from_ns(-inNs * 1.01)));
+        EXPECT_FALSE(fp.above_output_warning(PhaseOffset::from_ns(warnNs * 0.99)));
+        EXPECT_TRUE(fp.above_output_warning(PhaseOffset::from_ns(warnNs * 1.01)));
+
+        // Same verdicts as the double path for an offset measured from timestamps.
+        const uint64_t ref = 1'000'000'000ULL;
+        const auto t = ref + static_cast<uint64_t>(outNs * 0.5);
+        const PhaseOffset o = fp.offset(t, ref);
+        EXPECT_EQ(fp.within_output(o), PhaseTolerance::within_output(rate, o.us() < 0 ? -o.us() : o.us()));
+    }
+}
+
+// Verifies: REQ-F-DARS-004
+// TEST-FRAME-PHASE-004: Unsupported rates are invalid and fail every check
+TEST(FramePhaseTests, InvalidRates) {
+    for (double rate : {0.0, -48000.0, 1.0, 4e9}) {
+        const FramePhase fp(rate);
+        EXPECT_FALSE(fp.valid()) << rate;
+        EXPECT_FALSE(fp.within_input(PhaseOffset{}));
+        EXPECT_EQ(fp.offset(100, 0).q32, 0);
+    }
+}
+
+// Verifies: REQ-F-DARS-004
+// TEST-FRAME-PHASE-005: For AES5 rates the Q32 bands come from the PhaseTolerance ps
+// table, so FramePhase offsets check the same against both without a double round trip
+TEST(FramePhaseTests, BandsShareRateTable) {
+    for (uint32_t rate : {32000u, 44100u, 48000u, 88200u, 96000u, 176400u, 192000u}) {
+        const FramePhase fp(static_cast<double>(rate));
+        const auto index = PhaseTolerance::rate_index(rate);
+        ASSERT_TRUE(index.valid());
+        const auto bands = PhaseTolerance::bands(index);
+        for (uint64_t bandPs : {bands.outputTolerancePs, bands.inputTolerancePs, bands.outputWarningPs}) {
+            for (int64_t deltaPs : {-1, 0, 1}) {
+                const uint64_t ps = bandPs + static_cast<uint64_t>(deltaPs);
+                // Timestamps resolve 1 ns, so build the sub-ns offset directly.
+                const PhaseOffset o{-static_cast<int64_t>(((ps << 32) + 500) / 1000)};
+                EXPECT_EQ(o.abs_ps(), ps);
+                EXPECT_EQ(fp.within_output(o), PhaseTolerance::within_output(index, o.abs_ps())) << rate << " " << ps;
+                EXPECT_EQ(fp.within_input(o), PhaseTolerance::within_input(index, o.abs_ps())) << rate << " " << ps;
+                EXPECT_EQ(fp.above_output_warning(o), PhaseTolerance::above_output_warning(index, o.abs_ps()))
+                    << rate << " " << ps;
+            }
+        }
+        // A measured offset converts without going through double.
+        const PhaseOffset measured = fp.offset(1'000'000'500ULL, 1'000'000'000ULL);
+        EXPECT_EQ(measured.abs_ps(), 500'000u);
+    }
+}
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 #include "../../lib/Standards/AES/AES11/2009/sync/gps_reference_sync.hpp"
+#include <cmath>
+#include <random>
+#include <vector>
 
 using AES::AES11::_2009::sync::GPSReferenceSync;
 
@@ -31,3 +34,62 @@ TEST(GPSReferenceSyncTests, CustomToleranceAcceptance) {
     EXPECT_TRUE(GPSReferenceSync::within_alignment(trp, pps, 2.0));
     EXPECT_FALSE(GPSReferenceSync::within_alignment(trp, pps)); // default 1.0 µs
 }
+
+// Verifies: REQ-F-DARS-006
+// TEST-GPS-REF-004: Batch evaluation agrees with within_alignment() pair by pair
+TEST(GPSReferenceSyncTests, BatchMatchesPerPairEvaluation) {
+    std::mt19937_64 rng(3);
+    std::uniform_int_distribution<int64_t> offset(-1'500, 1'500);
+    const size_t n = 1'000; // not a multiple of 64
+    std::vector<uint64_t> trp(n), pps(n);
+    for (size_t i = 0; i < n; ++i) {
+        pps[i] = 1'000'000'000ULL * (i + 1);
+        trp[i] = static_cast<uint64_t>(static_cast<int64_t>(pps[i]) + offset(rng));
+    }
+    trp[700] = pps[700] - 1'600; // unique worst
+    std::vector<uint64_t> bitmap((n + 63) / 64, ~uint64_t{0});
+    const auto st = GPSReferenceSync::evaluate_alignment(trp.data(), pps.data(), n, 1'000, bitmap.data());
+    EXPECT_EQ(st.count, n);
+    EXPECT_EQ(st.worstOffsetNs, 1'600u);
+    EXPECT_EQ(st.worstIndex, 700u);
+    size_t bits = 0;
+    for (size_t i = 0; i < n; ++i) {
+        const bool ok = (bitmap[i / 64] >> (i % 64)) & 1u;
+        EXPECT_EQ(ok, GPSReferenceSync::within_alignment(trp[i], pps[i])) << i;
+        bits += ok ? 1 : 0;
+    }
+    EXPECT_EQ(st.passCount, bits);
+    EXPECT_EQ(bitmap.back() >> (n % 64), 0u) << "Unused bits are cleared";
+
+    double exactSum = 0.0, exactSq = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        const double d = static_cast<double>(static_cast<int64_t>(trp[i] - pps[i]));
+        exactSum += d;
+        exactSq += d * d;
+    }
+    EXPECT_NEAR(st.meanOffsetNs, exactSum / n, 1e-9);
+    EXPECT_NEAR(st.rmsOffsetNs, std::sqrt(exactSq / n), 1e-9);
+}
+
+// Verifies: REQ-F-DARS-006
+// TEST-GPS-REF-005: Large offsets stay exact; empty input yields zeroed statistics
+TEST(GPSReferenceSyncTests, BatchLargeOffsetsAndEmpty) {
+    const uint64_t pps[3] = {10'000'000'000ULL, 20'000'000'000ULL, 30'000'000'000ULL};
+    const uint64_t trp[3] = {pps[0] + 3'000'000'000ULL, pps[1] - 3'000'000'000ULL, pps[2]};
+    const auto st = GPSReferenceSync::evaluate_alignment(trp, pps, 3);
+    EXPECT_EQ(st.passCount, 1u);
+    EXPECT_FALSE(st.all_pass());
+    EXPECT_EQ(st.worstOffsetNs, 3'000'000'000ULL);
+    EXPECT_EQ(st.worstIndex, 0u);
+    EXPECT_DOUBLE_EQ(st.meanOffsetNs, 0.0);
+    EXPECT_NEAR(st.rmsOffsetNs, 3e9 * std::sqrt(2.0 / 3.0), 1e-3);
+
+    EXPECT_TRUE(GPSReferenceSync::evaluate_alignment(trp, pps, 3, uint64_t{1} << 40).all_pass());
+    const uint64_t small[2] = {pps[0] + 5, pps[1] - 7};
+    EXPECT_TRUE(GPSReferenceSync::evaluate_alignment(small, pps, 2, uint64_t{1} << 40).all_pass());
+
+    const auto empty = GPSReferenceSync::evaluate_alignment(trp, pps, 0);
+    EXPECT_EQ(empty.count, 0u);
+    EXPECT_TRUE(empty.all_pass());
+    EXPECT_EQ(empty.rmsOffsetNs, 0.0);
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include "../../lib/Standards/AES/AES11/2009/core/hampel_filter.hpp"
+#include "../../lib/Standards/Common/reliability/metrics.hpp"
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <vector>
+
+using AES::AES11::_2009::core::HampelFilter;
+using AES::AES11::_2009::core::RunningMedian;
+using AES::AES11::_2009::core::TimingWindowProcessor;
+using Common::reliability::ReliabilityMetrics;
+
+// Verifies: REQ-NF-PERF-003
+// TEST-DM-HAMPEL-001: Running median matches brute-force sliding median (odd and even windows)
+TEST(RunningMedianTests, MatchesBruteForce) {
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> dist(-50, 50); // duplicates exercise tie handling
+    for (size_t w : {1u, 2u, 5u, 8u, 31u}) {
+        RunningMedian rm(w);
+        std::deque<double> ref;
+        for (int i = 0; i < 2000; ++i) {
+            const double x = dist(rng);
+            rm.push(x);
+            ref.push_back(x);
+            if (ref.size() > w) ref.pop_front();
+            std::vector<double> sorted(ref.begin(), ref.end());
+            std::sort(sorted.begin(), sorted.end());
+            const size_t n = sorted.size();
+            const double expected = (n % 2) ? sorted[n / 2] : 0.5 * (sorted[n / 2 - 1] + sorted[n / 2]);
+            ASSERT_DOUBLE_EQ(rm.median(), expected) << "window " << w << " step " << i;
+        }
+    }
+}
+
+// Verifies: REQ-NF-PERF-003, PHASE05-RELIABILITY-HOOKS
+// TEST-DM-HAMPEL-002: Single missed-TRP spike is rejected and keeps the window stable
+TEST(HampelFilterTests, SpikeRejectedWindowStaysStable) {
+    ReliabilityMetrics::resetForTesting();
+    HampelFilter::Config cfg;
+    cfg.window = 9;
+    cfg.minSigma = 1.0;
+    HampelFilter filt(cfg);
+    TimingWindowProcessor raw(32, 100.0);
+    TimingWindowProcessor filtered(32, 100.0);
+    const double jitter[4] = {0.0, 2.0, -1.0, 1.0};
+    for (int i = 0; i < 32; ++i) {
+        // Interval doubles at i == 20 (one missed TRP)
+        double x = 20833.0 + jitter[i % 4];
+        if (i == 20) x *= 2.0;
+        raw.addSample(x);
+        auto d = filt.feed(filtered, x);
+        if (i == 20) {
+            EXPECT_EQ(d, HampelFilter::Decision::Rejected);
+        }
+    }
+    EXPECT_FALSE(raw.metrics().stable) << "Unfiltered window is skewed by the spike";
+    EXPECT_TRUE(filtered.metrics().stable);
+    EXPECT_EQ(filtered.metrics().count, 31u);
+    EXPECT_EQ(filt.rejected(), 1u);
+    EXPECT_EQ(ReliabilityMetrics::snapshot().timingOutliers, 1u);
+}
+
+// Verifies: REQ-NF-PERF-003
+// TEST-DM-HAMPEL-003: Clamp mode bounds the outlier instead of dropping it
+TEST(HampelFilterTests, ClampModeBoundsOutlier) {
+    HampelFilter::Config cfg;
+    cfg.window = 7;
+    cfg.warmup = 3;
+    cfg.minSigma = 2.0;
+    cfg.action = HampelFilter::Action::Clamp;
+    HampelFilter filt(cfg);
+    double out = 0.0;
+    for (int i = 0; i < 7; ++i) filt.filter(100.0, out);
+    auto d = filt.filter(1000.0, out);
+    EXPECT_EQ(d, HampelFilter::Decision::Clamped);
+    EXPECT_DOUBLE_EQ(out, 100.0 + 3.0 * 2.0);
+    EXPECT_EQ(filt.clamped(), 1u);
+    EXPECT_EQ(filt.rejected(), 0u);
+}
+
+// Verifies: REQ-NF-PERF-003
+// TEST-DM-HAMPEL-004: Persistent step change is accepted once it dominates the window
+TEST(HampelFilterTests, StepChangeEventuallyAccepted) {
+    HampelFilter::Config cfg;
+    cfg.window = 5;
+    cfg.warmup = 3;
+    cfg.minSigma = 1.0;
+    HampelFilter filt(cfg);
+    double out = 0.0;
+    for (int i = 0; i < 10; ++i) filt.filter(10.0, out);
+    int rejectedRun = 0;
+    HampelFilter::Decision d = HampelFilter::Decision::Rejected;
+    for (int i = 0; i < 10 && d == HampelFilter::Decision::Rejected; ++i) {
+        d = filt.filter(50.0, out);
+        if (d == HampelFilter::Decision::Rejected) ++rejectedRun;
+    }
+    EXPECT_EQ(d, HampelFilter::Decision::Accepted);
+    EXPECT_LE(rejectedRun, 3);
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include "../../lib/Standards/AES/AES11/2009/core/integer_timing_window.hpp"
+#include <cmath>
+#include <vector>
+
+using AES::AES11::_2009::core::IntegerTimingWindowProcessor;
+using Common::math::Int128;
+
+// Verifies: REQ-NF-PERF-003
+// TEST-UNIT-Int128-001: Exact products, signed arithmetic and ordering
+TEST(Int128Tests, ExactProductsAndSigns) {
+    const int64_t big = int64_t{1} << 62;
+    Int128 p = Int128::mul(big, 4); // 2^64
+    EXPECT_EQ(p.hi, 1);
+    EXPECT_EQ(p.lo, 0u);
+    EXPECT_EQ(Int128::mul(-3, 5), Int128(-15));
+    EXPECT_EQ(Int128::mul(-big, -4), p);
+    EXPECT_EQ(p - p, Int128(0));
+    EXPECT_TRUE(Int128(-1) < Int128(0));
+    EXPECT_TRUE(Int128::mul(-big, 4) < Int128(-1));
+    EXPECT_EQ(Int128(7) * -3, Int128(-21));
+    EXPECT_EQ(p * 3, Int128::mul(big, 12));
+    EXPECT_DOUBLE_EQ(Int128::mul(-big, 4).to_double(), -18446744073709551616.0);
+}
+
+// Verifies: REQ-NF-PERF-003
+// TEST-DM-TIMINGWIN-INT-001: Mean/variance match double window on small values, sliding
+TEST(IntegerTimingWindowTests, MatchesDoubleWindowForSmallValues) {
+    IntegerTimingWindowProcessor proc(4, 2.0);
+    for (int64_t v : {1, 2, 3, 4}) proc.addSample(v);
+    auto m = proc.metrics();
+    EXPECT_EQ(m.count, 4u);
+    EXPECT_DOUBLE_EQ(m.mean, 2.5);
+    EXPECT_DOUBLE_EQ(m.variance, 1.25);
+    EXPECT_TRUE(m.stable);
+    proc.addSample(5);
+    m = proc.metrics();
+    EXPECT_EQ(m.count, 4u);
+    EXPECT_DOUBLE_EQ(m.mean, 3.5);
+    EXPECT_DOUBLE_EQ(m.variance, 1.25);
+}
+
+// Verifies: REQ-NF-PERF-003
+// TEST-DM-TIMINGWIN-INT-002: Absolute ns timestamps over a simulated multi-week run stay exact
+TEST(IntegerTimingWindowTests, VarianceExactAcrossWeeksOfTimestamps) {
+    // 48 kHz frame period with a deterministic +/-3 ns jitter pattern.
+    const int64_t start = 1'700'000'000'000'000'000LL; // ~2023 in Unix ns
+    const int64_t period = 20'833;
+    const int64_t jitter[4] = {0, 3, 0, -3};
+    IntegerTimingWindowProcessor proc(64, 1e9);
+    // Jump forward in large strides to cover ~3 weeks while forcing many rebases.
+    int64_t t = start;
+    for (int stride = 0; stride < 2000; ++stride) {
+        t += 1'000'000'000LL * 900; // 15 minutes between bursts
+        for (int i = 0; i < 64; ++i) {
+            proc.addSample(t + i * period + jitter[i % 4]);
+        }
+    }
+    // Reference computed directly on the last window relative to its first sample.
+    std::vector<int64_t> rel;
+    for (int i = 0; i < 64; ++i) rel.push_back(i * period + jitter[i % 4]);
+    Int128 s1(0), s2(0);
+    for (int64_t r : rel) {
+        s1 += r;
+        s2 += Int128::mul(r, r);
+    }
+    Int128 num = s2 * 64 - Int128::mul(static_cast<int64_t>(s1.lo), static_cast<int64_t>(s1.lo));
+    auto ex = proc.exactMetrics();
+    EXPECT_EQ(ex.count, 64u);
+    EXPECT_EQ(ex.varianceNumerator, num) << "Variance numerator must be bit-exact";
+    EXPECT_EQ(proc.metrics().variance, num.to_double() / (64.0 * 64.0));
+}
+
+// Verifies: REQ-NF-PERF-003
+// TEST-DM-TIMINGWIN-INT-003: Evenly spaced samples that force repeated rebases stay exact
+TEST(IntegerTimingWindowTests, EvenlySpacedLargeStepsExact) {
+    IntegerTimingWindowProcessor proc(8, 1.0);
+    // Spread of a full window is 7 steps, inside the kRebaseLimitNs precondition, while
+    // the absolute advance over 100 samples rebases the epoch many times.
+    const int64_t step = IntegerTimingWindowProcessor::kRebaseLimitNs / 8;
+    const int64_t start = 5'000'000'000'000'000'000LL;
+    int64_t t = start;
+    for (int i = 0; i < 100; ++i) {
+        proc.addSample(t);
+        t += step;
+    }
+    auto ex = proc.exactMetrics();
+    EXPECT_EQ(ex.count, 8u);
+    EXPECT_GT(ex.epochNs - start, 80 * step) << "Epoch must follow the samples";
+    // Evenly spaced samples: variance = step^2 * (n^2 - 1) / 12
+    Int128 expectedNum = Int128::mul(step, step) * ((64 - 1) * 64 / 12);
+    EXPECT_EQ(ex.varianceNumerator, expectedNum);
+}
+
+// Verifies: REQ-NF-PERF-003
+// TEST-DM-TIMINGWIN-INT-004: Clear resets aggregates and epoch
+TEST(IntegerTimingWindowTests, ClearResets) {
+    IntegerTimingWindowProcessor proc(4, 1.0);
+    proc.addSample(100);
+    proc.addSample(200);
+    proc.clear();
+    auto m = proc.metrics();
+    EXPECT_EQ(m.count, 0u);
+    EXPECT_EQ(m.mean, 0.0);
+    EXPECT_EQ(m.variance, 0.0);
+    proc.addSample(-50);
+    EXPECT_EQ(proc.exactMetrics().epochNs, -50);
+}
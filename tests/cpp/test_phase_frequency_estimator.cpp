@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include "../../lib/Standards/AES/AES11/2009/core/phase_frequency_estimator.hpp"
+#include "../../lib/Standards/AES/AES11/2009/core/capture_range.hpp"
+#include "../../lib/Standards/AES/AES11/2009/core/phase_tolerance.hpp"
+#include "../../lib/Standards/AES/AES11/2009/sync/estimator_source_metrics.hpp"
+#include <cmath>
+
+using AES::AES11::_2009::core::CaptureRange;
+using AES::AES11::_2009::core::PhaseFrequencyEstimate;
+using AES::AES11::_2009::core::PhaseFrequencyEstimator2;
+using AES::AES11::_2009::core::PhaseFrequencyEstimator3;
+using AES::AES11::_2009::core::PhaseTolerance;
+using AES::AES11::_2009::sync::source_metrics_from_estimate;
+
+namespace {
+// TRP timestamp of frame k for a source with fractional frequency error yPpm (fast > 0),
+// drift in ppm/s and a constant phase offset relative to the reference grid.
+uint64_t trp_at(uint64_t origin, double rateHz, double yPpm, double driftPpmPerSec,
+                double phaseNs, uint64_t k) {
+    const double T = 1e9 / rateHz;
+    const double tNominal = static_cast<double>(k) * T;
+    const double tSec = tNominal * 1e-9;
+    const double y = (yPpm + 0.5 * driftPpmPerSec * tSec) * 1e-6;
+    return origin + static_cast<uint64_t>(std::llround(tNominal / (1.0 + y) + phaseNs));
+}
+} // namespace
+
+// Verifies: REQ-F-DARS-002, REQ-F-DARS-003
+// TEST-DARS-EST-001: Two-state filter converges to phase offset and frequency error
+TEST(PhaseFrequencyEstimatorTests, TwoStateConvergesToPhaseAndFrequency) {
+    const double rate = 48000.0;
+    const uint64_t origin = 10'000'000'000ULL;
+    PhaseFrequencyEstimator2 est(rate);
+    est.setGridOrigin(origin);
+    PhaseFrequencyEstimate e{};
+    for (uint64_t k = 0; k < 48000; ++k) {
+        e = est.update(trp_at(origin, rate, 3.0, 0.0, 2000.0, k));
+    }
+    EXPECT_NEAR(e.frequencyPpm, 3.0, 0.05);
+    EXPECT_EQ(e.driftPpmPerSec, 0.0);
+    EXPECT_EQ(e.samples, 48000u);
+    // After 1 s at +3 ppm the TRP has moved 3 µs earlier than the initial +2 µs offset.
+    EXPECT_NEAR(e.phaseOffsetNs, 2000.0 - 3000.0, 20.0);
+    EXPECT_LT(e.phaseStdDevNs, 10.0);
+}
+
+// Verifies: REQ-F-DARS-002
+// TEST-DARS-EST-002: Three-state filter tracks a linear frequency drift
+TEST(PhaseFrequencyEstimatorTests, ThreeStateTracksDrift) {
+    const double rate = 48000.0;
+    PhaseFrequencyEstimator3::Config cfg;
+    cfg.processNoise = 1e-3;
+    PhaseFrequencyEstimator3 est(rate, cfg);
+    PhaseFrequencyEstimate e{};
+    for (uint64_t k = 0; k < 4 * 48000; ++k) {
+        e = est.update(trp_at(0, rate, 1.0, 0.5, 0.0, k));
+    }
+    // Instantaneous frequency after 4 s: 1 + 0.5 * 4 = 3 ppm
+    EXPECT_NEAR(e.frequencyPpm, 3.0, 0.1);
+    EXPECT_NEAR(e.driftPpmPerSec, 0.5, 0.1);
+}
+
+// Verifies: REQ-F-DARS-002
+// TEST-DARS-EST-003: Missed TRPs are absorbed by grid rounding, not treated as phase jumps
+TEST(PhaseFrequencyEstimatorTests, MissedTrpsDoNotDisturbPhase) {
+    const double rate = 44100.0;
+    PhaseFrequencyEstimator2 est(rate);
+    PhaseFrequencyEstimate e{};
+    for (uint64_t k = 0; k < 20000; ++k) {
+        if (k % 97 == 0 && k > 0) continue; // drop a TRP periodically
+        e = est.update(trp_at(0, rate, 0.0, 0.0, 0.0, k));
+    }
+    EXPECT_NEAR(e.phaseOffsetNs, 0.0, 5.0);
+    EXPECT_NEAR(e.frequencyPpm, 0.0, 0.05);
+}
+
+// Verifies: REQ-F-DARS-003, REQ-F-DARS-004, REQ-F-SYNC-001
+// TEST-DARS-EST-004: Estimate feeds capture range, phase tolerance and SourceMetrics
+TEST(PhaseFrequencyEstimatorTests, FeedsCapturePhaseAndSourceMetrics) {
+    const double rate = 48000.0;
+    PhaseFrequencyEstimator2 good(rate);
+    PhaseFrequencyEstimator2 bad(rate);
+    PhaseFrequencyEstimate eg{}, eb{};
+    for (uint64_t k = 0; k < 24000; ++k) {
+        eg = good.update(trp_at(0, rate, 1.0, 0.0, 0.0, k));
+        eb = bad.update(trp_at(0, rate, 20.0, 0.0, 0.0, k));
+    }
+    EXPECT_TRUE(CaptureRange::within_capture(eg.abs_ppm_error(), CaptureRange::Grade::Grade1));
+    EXPECT_FALSE(CaptureRange::within_capture(eb.abs_ppm_error(), CaptureRange::Grade::Grade1));
+    EXPECT_TRUE(PhaseTolerance::within_input(rate, eg.abs_phase_offset_us()));
+
+    auto mg = source_metrics_from_estimate(eg, rate, CaptureRange::Grade::Grade1);
+    auto mb = source_metrics_from_estimate(eb, rate, CaptureRange::Grade::Grade1);
+    EXPECT_FALSE(mg.degraded);
+    EXPECT_TRUE(mb.degraded);
+    EXPECT_GT(mg.quality, mb.quality);
+}
@@ -1,7 +1,11 @@
 #include <gtest/gtest.h>
 #include "../../lib/Standards/AES/AES11/2009/core/phase_tolerance.hpp"
+#include "../../lib/Standards/AES/AES11/2009/core/sample_rate_validation.hpp"
+
+#include <cmath>
 
 using AES::AES11::_2009::core::PhaseTolerance;
+using AES::AES11::_2009::core::SampleRateValidator;
 
 // Verifies: REQ-F-DARS-004
 // TEST-DARS-PHASE-001: Output tolerance boundary at 48 kHz
@@ -62,3 +66,56 @@ TEST(PhaseToleranceTests, PhaseOffsetFromPpmDrift) {
     EXPECT_FALSE(PhaseTolerance::within_output(sr, offset30pctUs));
     EXPECT_FALSE(PhaseTolerance::within_input(sr, offset30pctUs));
 }
+
+// Verifies: REQ-F-DARS-004, REQ-F-DARS-008
+// TEST-DARS-PHASE-004: Integer ps tables cover exactly the AES5 standard rates and match the double API
+TEST(PhaseToleranceTests, RateTablesMatchDoubleApi) {
+    size_t standard = 0;
+    for (uint32_t rate = 8000; rate <= 384000; rate += 50) {
+        const auto idx = PhaseTolerance::rate_index(rate);
+        EXPECT_EQ(idx.valid(), SampleRateValidator::is_aes5_standard(rate)) << rate;
+        if (!idx.valid()) continue;
+        ++standard;
+        const double sr = static_cast<double>(rate);
+        EXPECT_EQ(PhaseTolerance::bands(idx).sampleRateHz, rate);
+        EXPECT_EQ(PhaseTolerance::frame_period_ps(idx),
+                  static_cast<uint64_t>(std::llround(PhaseTolerance::frame_period_us(sr) * 1e6)));
+        EXPECT_EQ(PhaseTolerance::output_tolerance_ps(idx),
+                  static_cast<uint64_t>(std::llround(PhaseTolerance::output_tolerance_us(sr) * 1e6)));
+        EXPECT_EQ(PhaseTolerance::input_tolerance_ps(idx),
+                  static_cast<uint64_t>(std::llround(PhaseTolerance::input_tolerance_us(sr) * 1e6)));
+        EXPECT_EQ(PhaseTolerance::output_warning_threshold_ps(idx),
+                  static_cast<uint64_t>(std::llround(PhaseTolerance::output_warning_threshold_us(sr) * 1e6)));
+    }
+    EXPECT_EQ(standard, PhaseTolerance::rate_count());
+}
+
+// Verifies: REQ-F-DARS-004
+// TEST-DARS-PHASE-005: Handle checks are inclusive integer compares; invalid handles fail
+TEST(PhaseToleranceTests, RateIndexBoundaries) {
+    constexpr auto k48 = PhaseTolerance::rate_index(48000);
+    static_assert(k48.valid(), "48 kHz is tabulated");
+    const uint64_t out = PhaseTolerance::output_tolerance_ps(k48);
+    const uint64_t in = PhaseTolerance::input_tolerance_ps(k48);
+    const uint64_t warn = PhaseTolerance::output_warning_threshold_ps(k48);
+    EXPECT_TRUE(PhaseTolerance::within_output(k48, out));
+    EXPECT_FALSE(PhaseTolerance::within_output(k48, out + 1));
+    EXPECT_TRUE(PhaseTolerance::within_input(k48, in));
+    EXPECT_FALSE(PhaseTolerance::within_input(k48, in + 1));
+    EXPECT_FALSE(PhaseTolerance::above_output_warning(k48, warn));
+    EXPECT_TRUE(PhaseTolerance::above_output_warning(k48, warn + 1));
+
+    // Same verdicts as the double API away from the rounding boundary.
+    for (double frac : {0.01, 0.044, 0.049, 0.051, 0.2, 0.249, 0.251}) {
+        const double us = PhaseTolerance::frame_period_us(48000.0) * frac;
+        const uint64_t ps = static_cast<uint64_t>(std::llround(us * 1e6));
+        EXPECT_EQ(PhaseTolerance::within_output(k48, ps), PhaseTolerance::within_output(48000.0, us)) << frac;
+        EXPECT_EQ(PhaseTolerance::within_input(k48, ps), PhaseTolerance::within_input(48000.0, us)) << frac;
+    }
+
+    const auto none = PhaseTolerance::rate_index(44056);
+    EXPECT_FALSE(none.valid());
+    EXPECT_FALSE(PhaseTolerance::within_input(none, 0));
+    EXPECT_FALSE(PhaseTolerance::above_output_warning(none, ~uint64_t{0}));
+    EXPECT_EQ(PhaseTolerance::frame_period_ps(none), 0u);
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include "../../lib/Standards/AES/AES11/2009/sync/pps_servo.hpp"
+#include <cstdlib>
+#include <type_traits>
+
+using AES::AES11::_2009::sync::PpsServo;
+
+namespace {
+// Local DARS timebase with a frequency error; the servo's corrections are applied to it.
+struct Plant {
+    double offsetNs;       // local TRP minus PPS
+    double freqErrorPpb;   // positive: local clock fast (TRPs drift earlier)
+    double correctionPpb{0.0};
+    uint64_t ppsNs{1'000'000'000ULL};
+
+    PpsServo::Output tick(PpsServo& servo, double noiseNs = 0.0) {
+        const uint64_t trp = static_cast<uint64_t>(static_cast<int64_t>(ppsNs) + static_cast<int64_t>(offsetNs + noiseNs));
+        const PpsServo::Output out = servo.update(trp, ppsNs);
+        offsetNs += static_cast<double>(out.phaseCorrectionNs);
+        correctionPpb = out.frequencyCorrectionPpb;
+        // Over the next second the error moves by -(freqError + correction) ns.
+        offsetNs -= freqErrorPpb + correctionPpb;
+        ppsNs += 1'000'000'000ULL;
+        return out;
+    }
+};
+} // namespace
+
+static_assert(std::is_trivially_copyable<PpsServo>::value, "Servo state must be fixed-size and copyable");
+
+// Verifies: REQ-F-DARS-006
+// TEST-GPS-SERVO-001: Steps a large initial offset, learns the frequency error and locks within ±1 µs
+TEST(PpsServoTests, AcquiresAndLocks) {
+    PpsServo servo;
+    Plant plant{50'000.0, 2'000.0};
+    EXPECT_EQ(plant.tick(servo).state, PpsServo::State::Unlocked);
+    const PpsServo::Output second = plant.tick(servo);
+    EXPECT_EQ(second.state, PpsServo::State::Acquiring);
+    EXPECT_NE(second.phaseCorrectionNs, 0);
+    EXPECT_EQ(servo.steps(), 1u);
+    int lockedAt = -1;
+    for (int i = 0; i < 60; ++i) {
+        const auto out = plant.tick(servo, (i % 2) ? 30.0 : -30.0);
+        if (lockedAt < 0 && out.state == PpsServo::State::Locked) lockedAt = i;
+    }
+    EXPECT_GE(lockedAt, 0);
+    EXPECT_LT(lockedAt, 20);
+    EXPECT_TRUE(servo.locked());
+    EXPECT_NEAR(servo.integral_ppb(), -2'000.0, 50.0);
+    EXPECT_LT(std::abs(plant.offsetNs), 100.0);
+    EXPECT_EQ(servo.steps(), 1u);
+}
+
+// Verifies: REQ-F-DARS-006
+// TEST-GPS-SERVO-002: Holdover keeps the learned frequency and re-acquires afterwards
+TEST(PpsServoTests, HoldoverAndRecovery) {
+    PpsServo servo;
+    Plant plant{0.0, -1'500.0};
+    for (int i = 0; i < 40; ++i) plant.tick(servo);
+    ASSERT_TRUE(servo.locked());
+    EXPECT_EQ(servo.check_holdover(plant.ppsNs + 1'000'000'000ULL), PpsServo::State::Locked);
+    EXPECT_EQ(servo.check_holdover(plant.ppsNs + 3'500'000'000ULL), PpsServo::State::Holdover);
+    EXPECT_NEAR(servo.holdover_frequency_ppb(), 1'500.0, 20.0);
+    // Five seconds in holdover at the learned rate: the phase hardly moves.
+    for (int i = 0; i < 5; ++i) {
+        plant.offsetNs -= plant.freqErrorPpb + servo.holdover_frequency_ppb();
+        plant.ppsNs += 1'000'000'000ULL;
+    }
+    EXPECT_LT(std::abs(plant.offsetNs), 100.0);
+    const double integral = servo.integral_ppb();
+    EXPECT_EQ(plant.tick(servo).state, PpsServo::State::Acquiring);
+    EXPECT_NEAR(servo.integral_ppb(), integral, 1e-9) << "Gap is not integrated";
+    for (int i = 0; i < 10; ++i) plant.tick(servo);
+    EXPECT_TRUE(servo.locked());
+}
+
+// Verifies: REQ-F-DARS-006
+// TEST-GPS-SERVO-003: A single outlier unlocks without stepping or winding up the integral
+TEST(PpsServoTests, OutlierWhileLocked) {
+    PpsServo servo;
+    Plant plant{0.0, 500.0};
+    for (int i = 0; i < 30; ++i) plant.tick(servo);
+    ASSERT_TRUE(servo.locked());
+    const double integral = servo.integral_ppb();
+    const auto out = plant.tick(servo, 80'000.0);
+    EXPECT_EQ(out.phaseCorrectionNs, 0);
+    EXPECT_EQ(out.state, PpsServo::State::Acquiring);
+    EXPECT_DOUBLE_EQ(servo.integral_ppb(), integral);
+    for (int i = 0; i < 10; ++i) plant.tick(servo);
+    EXPECT_TRUE(servo.locked());
+    EXPECT_EQ(servo.steps(), 0u);
+}
+
+// Verifies: REQ-F-DARS-006
+// TEST-GPS-SERVO-004: Frequency feed-forward removes the acquisition transient
+TEST(PpsServoTests, FeedForwardReducesTransient) {
+    auto worst = [](bool feedForward) {
+        PpsServo servo;
+        if (feedForward) servo.set_feed_forward(-3'000.0);
+        Plant plant{0.0, 3'000.0};
+        double w = 0.0;
+        for (int i = 0; i < 20; ++i) {
+            plant.tick(servo);
+            w = std::max(w, std::abs(plant.offsetNs));
+        }
+        return w;
+    };
+    EXPECT_LT(worst(true), 10.0);
+    EXPECT_GT(worst(false), 1'000.0);
+}
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include "../../lib/Standards/AES/AES11/2009/core/sample_timestamp_interpolator.hpp"
+#include <cmath>
+#include <vector>
+
+using AES::AES11::_2009::core::SampleTimestampInterpolator;
+using AES::AES11::_2009::core::TimingSnapshot;
+
+namespace {
+constexpr uint64_t kStartNs = 7'000'000'000'000ULL;
+
+// Ideal time of sample s for a 48 kHz source running ppm fast.
+double ideal_ns(uint64_t s, double ppm = 0.0) {
+    return static_cast<double>(kStartNs) + static_cast<double>(s) * 1e9 / (48000.0 * (1.0 + ppm * 1e-6));
+}
+
+TimingSnapshot trp_at(uint64_t sample, double ppm = 0.0, int64_t jitterNs = 0) {
+    return TimingSnapshot{sample, static_cast<uint64_t>(std::llround(ideal_ns(sample, ppm)) + jitterNs), sample, 0};
+}
+} // namespace
+
+// Verifies: REQ-NF-PERF-001
+// TEST-UNIT-SampleTs-001: ns-quantised TRPs give sample timestamps within 2 ns of ideal
+TEST(SampleTimestampInterpolatorTests, TracksNominalRate) {
+    SampleTimestampInterpolator interp({48000.0, 1'000'000});
+    uint64_t dummy = 0;
+    EXPECT_FALSE(interp.fill(0, &dummy, 1));
+    for (uint64_t s = 0; s <= 640; s += 64) ASSERT_TRUE(interp.addTrp(trp_at(s), s));
+    std::vector<uint64_t> ts(256);
+    ASSERT_TRUE(interp.fill(640, ts.data(), ts.size()));
+    for (size_t i = 0; i < ts.size(); ++i) {
+        EXPECT_NEAR(static_cast<double>(ts[i]), ideal_ns(640 + i), 2.0) << i;
+    }
+    EXPECT_NEAR(interp.nsPerSample(), 1e9 / 48000.0, 0.02); // includes the phase-correction term
+    EXPECT_EQ(interp.steps(), 0u);
+}
+
+// Verifies: REQ-NF-PERF-001
+// TEST-UNIT-SampleTs-002: Jittered, drifting TRPs give continuous monotonic timestamps
+TEST(SampleTimestampInterpolatorTests, ContinuousAcrossBuffers) {
+    SampleTimestampInterpolator interp({48000.0, 1'000'000});
+    const int64_t jitter[5] = {0, 40, -25, 10, -50};
+    constexpr size_t kBuffer = 64;
+    std::vector<uint64_t> all;
+    for (uint64_t b = 0; b < 200; ++b) {
+        const uint64_t first = b * kBuffer;
+        ASSERT_TRUE(interp.addTrp(trp_at(first, 20.0, jitter[b % 5]), first));
+        std::vector<uint64_t> buf(kBuffer);
+        ASSERT_TRUE(interp.fill(first, buf.data(), buf.size()));
+        all.insert(all.end(), buf.begin(), buf.end());
+    }
+    const double period = 1e9 / (48000.0 * (1.0 + 20e-6));
+    for (size_t i = 1; i < all.size(); ++i) {
+        const double step = static_cast<double>(all[i] - all[i - 1]);
+        ASSERT_GT(all[i], all[i - 1]);
+        // Per-sample step deviates by at most ~2 x jitter / TRP interval; never a jump.
+        ASSERT_NEAR(step, period, 4.0) << "discontinuity at sample " << i;
+    }
+    // Phase stays within the TRP jitter of the true timeline.
+    EXPECT_NEAR(static_cast<double>(all.back()), ideal_ns(all.size() - 1, 20.0), 60.0);
+    EXPECT_NEAR(interp.rateNsPerSample(), period, 0.25); // 2 x jitter over 8 TRP intervals
+}
+
+// Verifies: REQ-NF-PERF-001
+// TEST-UNIT-SampleTs-003: Bulk fill matches per-sample evaluation, including samples
+// before the latest TRP and a buffer spanning several fill blocks
+TEST(SampleTimestampInterpolatorTests, FillMatchesTimestamp) {
+    SampleTimestampInterpolator interp({44100.0, 1'000'000});
+    ASSERT_TRUE(interp.addTrp(TimingSnapshot{0, 1'000, 1, 0}, 1000));
+    ASSERT_TRUE(interp.addTrp(TimingSnapshot{0, 1'000 + 2'902'494, 2, 0}, 1128));
+    ASSERT_TRUE(interp.addTrp(TimingSnapshot{0, 1'000 + 5'804'999, 3, 0}, 1256));
+    std::vector<uint64_t> buf(300'000);
+    ASSERT_TRUE(interp.fill(1100, buf.data(), buf.size()));
+    for (size_t i = 0; i < buf.size(); i += (i < 1000 ? 1 : 997)) {
+        ASSERT_EQ(buf[i], interp.timestamp(1100 + i)) << i;
+    }
+    EXPECT_FALSE(interp.addTrp(TimingSnapshot{0, 9'999'999, 4, 0}, 1256)) << "Index must advance";
+}
+
+// Verifies: REQ-NF-PERF-001
+// TEST-UNIT-SampleTs-004: Phase error beyond maxStepNs re-anchors on the measurement
+TEST(SampleTimestampInterpolatorTests, LargeErrorSteps) {
+    SampleTimestampInterpolator interp({48000.0, 10'000});
+    ASSERT_TRUE(interp.addTrp(trp_at(0), 0));
+    ASSERT_TRUE(interp.addTrp(trp_at(64), 64));
+    const TimingSnapshot late{0, trp_at(128).time_ns + 50'000, 0, 0};
+    ASSERT_TRUE(interp.addTrp(late, 128));
+    EXPECT_EQ(interp.steps(), 1u);
+    EXPECT_EQ(interp.timestamp(128), late.time_ns);
+    interp.reset();
+    EXPECT_FALSE(interp.ready());
+    EXPECT_EQ(interp.timestamp(5), 0u);
+}
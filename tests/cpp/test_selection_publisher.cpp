@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+#include "../../lib/Standards/AES/AES11/2009/sync/scoring_policies.hpp"
+#include "../../lib/Standards/AES/AES11/2009/sync/selection_publisher.hpp"
+#include "../../lib/Standards/Common/concurrency/asymmetric_fence.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using AES::AES11::_2009::sync::SelectionPublisher;
+using AES::AES11::_2009::sync::SelectionSnapshot;
+using AES::AES11::_2009::sync::SourceMetrics;
+using AES::AES11::_2009::sync::SynchronizationManager;
+using Common::concurrency::EpochPublisher;
+
+namespace {
+struct Counted {
+    static int live;
+    uint64_t a;
+    uint64_t b;
+    Counted(uint64_t x = 0) : a(x), b(x * 3) { ++live; }
+    Counted(const Counted& o) : a(o.a), b(o.b) { ++live; }
+    ~Counted() { --live; }
+};
+int Counted::live = 0;
+} // namespace
+
+// Verifies: REQ-NF-PERF-001
+// TEST-UNIT-EpochPublisher-001: A retired value survives while a guard taken before the swap lives
+TEST(EpochPublisherTests, ReclaimWaitsForGuards) {
+    Counted::live = 0;
+    {
+        EpochPublisher<Counted, 4> pub(Counted(1));
+        auto reader = pub.register_reader();
+        ASSERT_TRUE(reader.valid());
+        {
+            auto g = reader.read();
+            pub.publish(Counted(2));
+            EXPECT_EQ(g->a, 1u) << "Guard keeps the value it pinned";
+            EXPECT_EQ(pub.retired(), 1u);
+            EXPECT_EQ(pub.current().a, 2u);
+        }
+        EXPECT_EQ(pub.reclaim(), 0u);
+        {
+            auto g = reader.read();
+            EXPECT_EQ(g->a, 2u);
+            pub.publish(Counted(3)); // this reader entered before the swap
+            pub.publish(Counted(4));
+            EXPECT_EQ(pub.retired(), 2u);
+        }
+        pub.publish(Counted(5));
+        EXPECT_EQ(pub.retired(), 0u);
+        EXPECT_EQ(reader.load().a, 5u);
+        EXPECT_EQ(Counted::live, 1);
+    }
+    EXPECT_EQ(Counted::live, 0);
+}
+
+// Verifies: REQ-NF-PERF-001
+// TEST-UNIT-EpochPublisher-002: Reader slots are a fixed pool returned on destruction
+TEST(EpochPublisherTests, ReaderPoolIsBounded) {
+    EpochPublisher<int, 2> pub(7);
+    auto r1 = pub.register_reader();
+    {
+        auto r2 = pub.register_reader();
+        auto r3 = pub.register_reader();
+        EXPECT_TRUE(r2.valid());
+        EXPECT_FALSE(r3.valid());
+    }
+    auto r4 = pub.register_reader();
+    EXPECT_TRUE(r4.valid());
+    EXPECT_EQ(r4.load(), 7);
+}
+
+// Verifies: REQ-NF-PERF-001
+// TEST-UNIT-EpochPublisher-003: Concurrent readers never see a torn or freed value
+TEST(EpochPublisherTests, ConcurrentReadersSeeConsistentValues) {
+    EpochPublisher<Counted, 8> pub(Counted(0));
+    std::atomic<bool> done{false};
+    std::atomic<bool> bad{false};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 3; ++t) {
+        readers.emplace_back([&]() {
+            auto reader = pub.register_reader();
+            uint64_t last = 0;
+            while (!done.load()) {
+                auto g = reader.read();
+                if (g->b != g->a * 3 || g->a < last) bad = true;
+                last = g->a;
+            }
+        });
+    }
+    for (uint64_t i = 1; i <= 20000; ++i) pub.publish(Counted(i));
+    done = true;
+    for (auto& t : readers) t.join();
+    EXPECT_FALSE(bad.load());
+    EXPECT_EQ(pub.reclaim(), 0u);
+}
+
+// Verifies: REQ-F-SYNC-001, REQ-NF-PERF-001
+// TEST-SYNC-PUBLISH-001: Published selection carries the reference, its metrics and switch count
+TEST(SelectionPublisherTests, PublishesSelectDecisions) {
+    SelectionPublisher publisher;
+    auto reader = publisher.register_reader();
+    ASSERT_TRUE(reader.valid());
+    EXPECT_EQ(reader.load().reference, SynchronizationManager::invalidIndex());
+
+    SynchronizationManager mgr(0.1);
+    std::vector<SourceMetrics> sources = {{0.1, 5.0, false}, {0.1, 6.0, false}};
+    EXPECT_EQ(publisher.publish_select(mgr, sources), 1u);
+    SelectionSnapshot s = reader.load();
+    EXPECT_EQ(s.reference, 1u);
+    EXPECT_DOUBLE_EQ(s.metrics.quality, 6.0);
+    EXPECT_DOUBLE_EQ(s.score, 5.9);
+    EXPECT_EQ(s.sequence, 1u);
+    EXPECT_EQ(s.switches, 0u);
+
+    sources[0].quality = 8.0;
+    publisher.publish_select(mgr, sources);
+    s = reader.load();
+    EXPECT_EQ(s.reference, 0u);
+    EXPECT_EQ(s.sequence, 2u);
+    EXPECT_EQ(s.switches, 1u);
+}
+
+// Verifies: REQ-F-SYNC-001
+// TEST-SYNC-PUBLISH-002: Incremental path publishes failover results
+TEST(SelectionPublisherTests, PublishesIncrementalDecisions) {
+    SelectionPublisher publisher;
+    auto reader = publisher.register_reader();
+    SynchronizationManager mgr(0.1);
+    mgr.update_source(0, SourceMetrics{0.0, 6.0, false});
+    mgr.update_source(1, SourceMetrics{0.0, 5.0, false});
+    EXPECT_EQ(publisher.publish_best(mgr), 0u);
+    mgr.failover(0);
+    EXPECT_EQ(publisher.publish_best(mgr), 1u);
+    const SelectionSnapshot s = reader.load();
+    EXPECT_EQ(s.reference, 1u);
+    EXPECT_DOUBLE_EQ(s.metrics.quality, 5.0);
+    EXPECT_EQ(s.switches, 1u);
+    EXPECT_EQ(publisher.retired(), 0u);
+}
+
+// Verifies: REQ-NF-PERF-001
+// TEST-UNIT-AsymmetricFence-001: Store-buffering litmus: a thread using light_fence() and
+// one using heavy_fence() never both miss the other's store
+TEST(AsymmetricFenceTests, LightAndHeavyFenceOrderStoreBeforeLoad) {
+    const bool membarrier = Common::concurrency::init_asymmetric_fence();
+    EXPECT_EQ(Common::concurrency::init_asymmetric_fence(), membarrier) << "Registration is one-time";
+    constexpr int kRounds = 2000;
+    std::atomic<int> x{0}, y{0}, round{0}, heavyDone{0};
+    std::atomic<bool> heavySaw{false};
+    std::thread heavy([&]() {
+        for (int r = 1; r <= kRounds; ++r) {
+            while (round.load() != r) std::this_thread::yield();
+            y.store(r, std::memory_order_relaxed);
+            Common::concurrency::heavy_fence();
+            heavySaw.store(x.load(std::memory_order_relaxed) == r);
+            heavyDone.store(r);
+        }
+    });
+    int bothMissed = 0;
+    for (int r = 1; r <= kRounds; ++r) {
+        round.store(r);
+        x.store(r, std::memory_order_relaxed);
+        Common::concurrency::light_fence();
+        const bool lightSaw = y.load(std::memory_order_relaxed) == r;
+        while (heavyDone.load() != r) std::this_thread::yield();
+        if (!lightSaw && !heavySaw.load()) ++bothMissed;
+    }
+    heavy.join();
+    EXPECT_EQ(bothMissed, 0);
+}
+
+// Verifies: REQ-F-SYNC-001
+// TEST-SYNC-PUBLISH-003: publish_select and publish_best work with a non-default policy
+// and publish that policy's score
+TEST(SelectionPublisherTests, PublishesWithExtendedMetricsPolicy) {
+    using AES::AES11::_2009::sync::ExtendedSourceMetrics;
+    using AES::AES11::_2009::sync::MtieSynchronizationManager;
+    SelectionPublisher publisher;
+    auto reader = publisher.register_reader();
+    MtieSynchronizationManager mgr(0.1);
+    ExtendedSourceMetrics wander{}, steady{};
+    wander.quality = 6.0;
+    wander.mtieNs = 400.0; // 6.0 - 4.0
+    steady.quality = 5.0;
+    steady.mtieNs = 100.0; // 5.0 - 1.0
+    mgr.update_source(0, wander);
+    mgr.update_source(1, steady);
+    EXPECT_EQ(publisher.publish_best(mgr), 1u);
+    SelectionSnapshot s = reader.load();
+    EXPECT_EQ(s.reference, 1u);
+    EXPECT_DOUBLE_EQ(s.score, 4.0);
+    MtieSynchronizationManager byList(0.1);
+    EXPECT_EQ(publisher.publish_select(byList, {wander, steady}), 1u);
+    s = reader.load();
+    EXPECT_DOUBLE_EQ(s.metrics.quality, 5.0);
+    EXPECT_DOUBLE_EQ(s.score, 4.0);
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include "../../lib/Standards/AES/AES11/2009/core/snapshot_journal.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using AES::AES11::_2009::core::SnapshotJournal;
+using AES::AES11::_2009::core::SnapshotJournalReader;
+using AES::AES11::_2009::core::SnapshotJournalRecord;
+using AES::AES11::_2009::core::TimingSnapshot;
+
+#if defined(__unix__) || defined(__APPLE__)
+namespace {
+std::string temp_journal_path(const char* name) {
+    std::string p = ::testing::TempDir() + name;
+    std::remove(p.c_str());
+    return p;
+}
+} // namespace
+
+// Verifies: REQ-NF-REL-004
+// TEST-TIMESRC-JOURNAL-001: Records survive close/reopen and iterate oldest-first after wrap
+TEST(SnapshotJournalTests, WrapAndReopen) {
+    const std::string path = temp_journal_path("aes11_journal_wrap.bin");
+    {
+        SnapshotJournal j;
+        ASSERT_TRUE(j.open(path, 8));
+        for (uint64_t i = 1; i <= 20; ++i) j.append(TimingSnapshot{i * 10, i * 100, i, 0});
+    } // simulated shutdown / crash: mapping dropped without further action
+    SnapshotJournalReader r;
+    ASSERT_TRUE(r.open(path));
+    EXPECT_EQ(r.capacity(), 8u);
+    EXPECT_EQ(r.tail(), 20u);
+    EXPECT_EQ(r.wrapCount(), 2u);
+    std::vector<uint64_t> seqs;
+    uint64_t skipped = 99;
+    const uint64_t n = r.forEach([&](uint64_t ticket, const SnapshotJournalRecord& rec) {
+        EXPECT_EQ(rec.seq, ticket + 1);
+        EXPECT_EQ(rec.time_ns, rec.seq * 100);
+        seqs.push_back(rec.seq);
+    }, &skipped);
+    EXPECT_EQ(n, 8u);
+    EXPECT_EQ(skipped, 0u);
+    EXPECT_EQ(seqs.front(), 13u);
+    EXPECT_EQ(seqs.back(), 20u);
+
+    // Writer reopen continues after the last ticket; mismatched capacity is refused.
+    SnapshotJournal again;
+    EXPECT_FALSE(again.open(path, 16));
+    ASSERT_TRUE(again.open(path, 8));
+    EXPECT_EQ(again.appended(), 20u);
+    again.append(TimingSnapshot{0, 0, 21, 0});
+    EXPECT_EQ(again.appended(), 21u);
+    std::remove(path.c_str());
+}
+
+// Verifies: REQ-NF-REL-004
+// TEST-TIMESRC-JOURNAL-002: Concurrent producers commit every record exactly once
+TEST(SnapshotJournalTests, ConcurrentProducers) {
+    const std::string path = temp_journal_path("aes11_journal_mpsc.bin");
+    SnapshotJournal j;
+    ASSERT_TRUE(j.open(path, 4096));
+    constexpr int threads = 4;
+    constexpr uint64_t perThread = 1000;
+    std::vector<std::thread> ts;
+    for (int t = 0; t < threads; ++t) {
+        ts.emplace_back([&, t]() {
+            for (uint64_t i = 0; i < perThread; ++i) {
+                j.append(TimingSnapshot{i, i, static_cast<uint64_t>(t) * perThread + i + 1, 0});
+            }
+        });
+    }
+    for (auto& th : ts) th.join();
+    SnapshotJournalReader r;
+    ASSERT_TRUE(r.open(path));
+    std::vector<bool> seen(threads * perThread + 1, false);
+    uint64_t skipped = 0;
+    EXPECT_EQ(r.forEach([&](uint64_t, const SnapshotJournalRecord& rec) { seen[rec.seq] = true; }, &skipped),
+              threads * perThread);
+    EXPECT_EQ(skipped, 0u);
+    EXPECT_EQ(std::count(seen.begin() + 1, seen.end(), true), static_cast<long>(threads * perThread));
+    j.close();
+    std::remove(path.c_str());
+}
+
+// Verifies: REQ-NF-REL-004
+// TEST-TIMESRC-JOURNAL-003: Reader rejects files that are not journals
+TEST(SnapshotJournalTests, RejectsForeignFile) {
+    const std::string path = temp_journal_path("aes11_journal_bad.bin");
+    FILE* f = std::fopen(path.c_str(), "wb");
+    ASSERT_NE(f, nullptr);
+    const char junk[128] = "not a journal";
+    std::fwrite(junk, 1, sizeof(junk), f);
+    std::fclose(f);
+    SnapshotJournalReader r;
+    EXPECT_FALSE(r.open(path));
+    SnapshotJournal w;
+    EXPECT_FALSE(w.open(path, 2)) << "Existing non-journal file must not be overwritten";
+    std::remove(path.c_str());
+}
+
+// Verifies: REQ-NF-REL-004
+// TEST-TIMESRC-JOURNAL-004: Capacities whose mapping size overflows are rejected, both
+// when creating and when a file header claims one
+TEST(SnapshotJournalTests, RejectsOverflowingCapacity) {
+    const std::string path = temp_journal_path("aes11_journal_huge.bin");
+    SnapshotJournal w;
+    EXPECT_FALSE(w.open(path, SnapshotJournal::kMaxCapacity + 1));
+    EXPECT_FALSE(w.open(path, ~uint64_t{0}));
+    FILE* created = std::fopen(path.c_str(), "rb");
+    EXPECT_EQ(created, nullptr) << "Rejected before the file is created";
+    if (created) std::fclose(created);
+
+    // Valid magic and layout, but capacity * 40 wraps to 0 in 64 bits.
+    unsigned char file[128] = {'A', 'E', 'S', '1', '1', 'S', 'N', 'J'};
+    const uint32_t version = SnapshotJournal::kFormatVersion;
+    const uint32_t recordSize = sizeof(SnapshotJournalRecord);
+    const uint64_t capacity = uint64_t{1} << 61;
+    std::memcpy(file + 8, &version, sizeof(version));
+    std::memcpy(file + 12, &recordSize, sizeof(recordSize));
+    std::memcpy(file + 16, &capacity, sizeof(capacity));
+    FILE* f = std::fopen(path.c_str(), "wb");
+    ASSERT_NE(f, nullptr);
+    std::fwrite(file, 1, sizeof(file), f);
+    std::fclose(f);
+    SnapshotJournalReader r;
+    EXPECT_FALSE(r.open(path));
+    std::remove(path.c_str());
+}
+#endif
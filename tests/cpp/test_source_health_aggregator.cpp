@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include "../../lib/Standards/AES/AES11/2009/sync/source_health_aggregator.hpp"
+#include "../../lib/Standards/AES/AES11/2009/sync/scoring_policies.hpp"
+#include <vector>
+
+using AES::AES11::_2009::core::DARSGrade;
+using AES::AES11::_2009::sync::GradeSynchronizationManager;
+using AES::AES11::_2009::sync::SourceHealthAggregator;
+using AES::AES11::_2009::sync::SourceMetrics;
+using AES::AES11::_2009::sync::SynchronizationManager;
+
+// Verifies: REQ-F-SYNC-001
+// TEST-SYNC-HEALTH-001: Only sources whose metrics changed are pushed to the manager
+TEST(SourceHealthAggregatorTests, PushesOnlyChangedSources) {
+    SourceHealthAggregator agg(SourceHealthAggregator::Config{});
+    SynchronizationManager mgr(0.1);
+    for (size_t id = 0; id < 100; ++id) {
+        agg.add_rate_measurement(id, 48000.0);
+        agg.add_phase_sample(id, 100 + static_cast<int64_t>(id));
+    }
+    EXPECT_EQ(agg.push_changes(mgr), 100u);
+    EXPECT_EQ(mgr.best(), 0u) << "Smallest phase offset has the largest margin";
+    EXPECT_EQ(agg.push_changes(mgr), 0u);
+
+    agg.add_rate_measurement(5, 48000.0); // same classification and ppm: no change
+    EXPECT_EQ(agg.pending(), 0u);
+    agg.add_phase_sample(7, 107);         // same phase, variance still zero
+    EXPECT_EQ(agg.pending(), 0u);
+    agg.add_phase_sample(42, 0);
+    agg.add_phase_sample(42, 0);          // queued once
+    agg.add_rate_measurement(3, 48000.3); // Warning
+    EXPECT_EQ(agg.push_changes(mgr), 2u);
+    EXPECT_EQ(agg.pushes(), 102u);
+    EXPECT_EQ(mgr.best(), 0u);
+    EXPECT_NE(mgr.source_metrics(42).stability, 0.0);
+}
+
+// Verifies: REQ-F-DARS-004, REQ-F-DARS-008
+// TEST-SYNC-HEALTH-002: Rate failure, phase outside tolerance and unstable windows degrade
+TEST(SourceHealthAggregatorTests, DegradedConditions) {
+    SourceHealthAggregator::Config cfg;
+    cfg.varianceThresholdNs2 = 100.0;
+    SourceHealthAggregator agg(cfg);
+    agg.add_rate_measurement(0, 48000.0);
+    agg.add_phase_sample(0, 500);
+    EXPECT_FALSE(agg.metrics(0).degraded);
+    EXPECT_NEAR(agg.metrics(0).quality, 1.0 + (1.0 - 0.5 / 5.2083333), 1e-6);
+
+    agg.add_rate_measurement(1, 48001.0); // ~20.8 ppm: Fail
+    EXPECT_TRUE(agg.metrics(1).degraded);
+    EXPECT_NEAR(agg.metrics(1).ppmError, 20.8333, 1e-3);
+
+    agg.add_phase_sample(2, 6000); // beyond 25% of a 48 kHz frame
+    EXPECT_TRUE(agg.metrics(2).degraded);
+    EXPECT_EQ(agg.metrics(2).quality, 0.0);
+
+    agg.add_phase_sample(3, 0);
+    EXPECT_FALSE(agg.metrics(3).degraded) << "One sample is not enough to judge stability";
+    agg.add_phase_sample(3, 100);
+    EXPECT_TRUE(agg.metrics(3).degraded);
+    EXPECT_NEAR(agg.metrics(3).stability, 0.05, 1e-9);
+}
+
+// Verifies: REQ-F-SYNC-001
+// TEST-SYNC-HEALTH-003: Deadbands suppress insignificant pushes; removal withdraws the source
+TEST(SourceHealthAggregatorTests, DeadbandAndRemoval) {
+    SourceHealthAggregator::Config cfg;
+    cfg.qualityDeadband = 0.05;
+    cfg.stabilityDeadband = 1.0;
+    SourceHealthAggregator agg(cfg);
+    SynchronizationManager mgr(0.0);
+    agg.add_phase_sample(0, 0);
+    agg.add_phase_sample(1, 1000);
+    EXPECT_EQ(agg.push_changes(mgr), 2u);
+    agg.add_phase_sample(1, 1010); // quality moves by ~0.002
+    EXPECT_EQ(agg.pending(), 0u);
+    agg.add_phase_sample(1, 2000);
+    EXPECT_EQ(agg.pending(), 1u);
+    agg.push_changes(mgr);
+    EXPECT_EQ(mgr.best(), 0u);
+    agg.remove_source(0);
+    EXPECT_EQ(agg.push_changes(mgr), 1u);
+    EXPECT_EQ(mgr.best(), 1u);
+    agg.add_phase_sample(0, 0); // reappears
+    EXPECT_EQ(agg.push_changes(mgr), 1u);
+    EXPECT_EQ(mgr.best_candidate(), 0u);
+}
+
+// Verifies: REQ-F-SYNC-001, REQ-F-DARS-002
+// TEST-SYNC-HEALTH-004: Grade and ppm reach policy-based managers
+TEST(SourceHealthAggregatorTests, FeedsScoringPolicyInputs) {
+    SourceHealthAggregator agg(SourceHealthAggregator::Config{});
+    GradeSynchronizationManager mgr(0.1);
+    agg.add_phase_sample(0, 0);
+    agg.set_grade(0, DARSGrade::Grade2);
+    agg.add_phase_sample(1, 300);
+    agg.set_grade(1, DARSGrade::Grade1);
+    agg.push_changes(mgr);
+    EXPECT_EQ(mgr.best(), 1u);
+    EXPECT_EQ(mgr.source_metrics(1).grade, DARSGrade::Grade1);
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include "../../lib/Standards/AES/AES11/2009/sync/source_table.hpp"
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+using AES::AES11::_2009::sync::SourceMetrics;
+using AES::AES11::_2009::sync::SourceTable;
+using AES::AES11::_2009::sync::SynchronizationManager;
+
+namespace {
+// Coarse values so equal scores (ties) are common.
+std::vector<SourceMetrics> randomSources(std::mt19937_64& rng, size_t n) {
+    std::uniform_int_distribution<int> q(0, 20), s(0, 4), d(0, 9);
+    std::vector<SourceMetrics> v(n);
+    for (auto& m : v) m = SourceMetrics{0.25 * s(rng), 0.5 * q(rng), d(rng) == 0};
+    return v;
+}
+} // namespace
+
+// Verifies: REQ-F-SYNC-001, REQ-NF-PERF-001
+// TEST-SYNC-BULK-001: Bulk argmax matches the select() scan for all sizes, ties and degraded flags
+TEST(SourceTableTests, ArgmaxMatchesScalarScan) {
+    std::mt19937_64 rng(42);
+    for (size_t n : {1u, 2u, 7u, 63u, 64u, 65u, 130u, 1000u, 4099u}) {
+        for (int rep = 0; rep < 20; ++rep) {
+            const auto sources = randomSources(rng, n);
+            SynchronizationManager scalar(0.0);
+            const size_t expected = scalar.select(sources);
+            const SourceTable table(sources);
+            const auto best = table.argmax_default();
+            ASSERT_EQ(best.index, expected) << "n=" << n << " rep=" << rep;
+            EXPECT_EQ(best.score, table.default_score(expected));
+        }
+    }
+}
+
+// Verifies: REQ-F-SYNC-001
+// TEST-SYNC-BULK-002: NaN and signed-zero scores resolve exactly as select() does
+TEST(SourceTableTests, NanAndSignedZeroMatchScalar) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const std::vector<std::vector<SourceMetrics>> cases = {
+        {{0.0, nan, false}, {0.0, 9.0, false}},                     // NaN first: index 0 kept
+        {{0.0, 1.0, false}, {0.0, nan, false}, {0.0, 2.0, false}},  // NaN later never wins
+        {{0.0, -0.0, false}, {0.0, 0.0, false}},                    // -0 == +0: first kept
+        {{0.0, -std::numeric_limits<double>::infinity(), false}, {nan, 1.0, false}},
+    };
+    for (size_t c = 0; c < cases.size(); ++c) {
+        SynchronizationManager scalar(0.0);
+        EXPECT_EQ(SourceTable(cases[c]).argmax_default().index, scalar.select(cases[c])) << "case " << c;
+    }
+}
+
+// Verifies: REQ-F-SYNC-001
+// TEST-SYNC-BULK-003: select_bulk() reproduces select() decisions, hysteresis included
+TEST(SourceTableTests, SelectBulkMatchesSelectSequence) {
+    std::mt19937_64 rng(7);
+    auto sources = randomSources(rng, 300);
+    SourceTable table(sources);
+    SynchronizationManager scalar(0.6), bulk(0.6);
+    std::uniform_int_distribution<size_t> pick(0, sources.size() - 1);
+    std::uniform_int_distribution<int> q(0, 24), d(0, 6);
+    size_t switches = 0;
+    size_t last = SynchronizationManager::invalidIndex();
+    for (int step = 0; step < 2000; ++step) {
+        for (int k = 0; k < 5; ++k) {
+            const size_t i = pick(rng);
+            sources[i].quality = 0.5 * q(rng);
+            sources[i].degraded = d(rng) == 0;
+            table.set(i, sources[i]);
+        }
+        const size_t a = scalar.select(sources);
+        ASSERT_EQ(bulk.select_bulk(table), a) << "step " << step;
+        if (last != SynchronizationManager::invalidIndex() && a != last) ++switches;
+        last = a;
+    }
+    EXPECT_GT(switches, 0u);
+}
+
+// Verifies: REQ-F-SYNC-001
+// TEST-SYNC-BULK-004: resize clears flags past the end; empty table selects nothing
+TEST(SourceTableTests, ResizeAndEmpty) {
+    SourceTable table;
+    SynchronizationManager mgr(0.1);
+    EXPECT_EQ(mgr.select_bulk(table), SynchronizationManager::invalidIndex());
+    table.resize(70);
+    table.set(69, SourceMetrics{0.0, 1.0, true});
+    table.resize(65);
+    table.resize(70);
+    EXPECT_FALSE(table.degraded(69));
+    EXPECT_EQ(table.quality(69), 0.0);
+    table.set_quality(3, 2.0);
+    EXPECT_EQ(mgr.select_bulk(table), 3u);
+}
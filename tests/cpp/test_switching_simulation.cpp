@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include "../../lib/Standards/AES/AES11/2009/sync/switching_simulation.hpp"
+
+using AES::AES11::_2009::sync::SwitchingSimulation;
+
+namespace {
+SwitchingSimulation::Config noisyPair(double margin) {
+    SwitchingSimulation::Config cfg;
+    cfg.sources.resize(2);
+    cfg.sources[0].quality = 1.00;
+    cfg.sources[1].quality = 0.99;
+    cfg.sources[0].noise = cfg.sources[1].noise = 0.02;
+    cfg.durationNs = 100'000'000'000ULL; // 1000 selections at 10 Hz
+    cfg.hysteresisMargin = margin;
+    return cfg;
+}
+} // namespace
+
+// Verifies: REQ-F-SYNC-001
+// TEST-SYNC-SIM-001: Noiseless, static sources never switch and are never suboptimal
+TEST(SwitchingSimulationTests, StaticSourcesHold) {
+    SwitchingSimulation::Config cfg;
+    cfg.sources.resize(4);
+    for (size_t i = 0; i < 4; ++i) cfg.sources[i].quality = 0.5 + 0.1 * static_cast<double>(i);
+    cfg.durationNs = 10'000'000'000ULL;
+    const auto r = SwitchingSimulation(cfg).run();
+    EXPECT_EQ(r.selections, 100u);
+    EXPECT_EQ(r.switches, 0u);
+    EXPECT_EQ(r.suboptimalNs, 0u);
+    EXPECT_LE(r.latencyP50Ns, r.latencyP99Ns);
+    EXPECT_LE(r.latencyP999Ns, r.latencyMaxNs);
+}
+
+// Verifies: REQ-F-SYNC-001
+// TEST-SYNC-SIM-002: Wider hysteresis trades switches for suboptimal time under noise
+TEST(SwitchingSimulationTests, HysteresisReducesNoiseSwitching) {
+    const auto churn = SwitchingSimulation(noisyPair(0.0)).run();
+    const auto held = SwitchingSimulation(noisyPair(0.2)).run();
+    EXPECT_GT(churn.switches, 100u);
+    EXPECT_LT(held.switches, 5u);
+    EXPECT_GT(churn.suboptimalFraction(), 0.1);
+}
+
+// Verifies: REQ-F-SYNC-001
+// TEST-SYNC-SIM-003: Dropouts, drift and degradation are followed; both modes decide identically
+TEST(SwitchingSimulationTests, SchedulesAndModeEquivalence) {
+    SwitchingSimulation::Config cfg;
+    cfg.sources.resize(3);
+    cfg.sources[0].quality = 1.0;
+    cfg.sources[0].dropouts = {{10'000'000'000ULL, 20'000'000'000ULL}};
+    cfg.sources[1].quality = 0.9;
+    cfg.sources[1].degradations = {{0, 30'000'000'000ULL}};
+    cfg.sources[2].quality = 0.95;
+    cfg.sources[2].driftPpmPerHour = 360.0; // loses 0.1 quality every 36 s at ppmPenalty 0.1
+    cfg.durationNs = 60'000'000'000ULL;
+    cfg.hysteresisMargin = 0.0;
+    cfg.mode = SwitchingSimulation::Mode::Full;
+    const auto full = SwitchingSimulation(cfg).run();
+    cfg.mode = SwitchingSimulation::Mode::Incremental;
+    const auto inc = SwitchingSimulation(cfg).run();
+    EXPECT_EQ(full.switches, 2u) << "0 -> 2 on dropout, back to 0 when it returns";
+    EXPECT_EQ(full.suboptimalNs, 0u);
+    EXPECT_EQ(inc.switches, full.switches);
+    EXPECT_EQ(inc.suboptimalSelections, full.suboptimalSelections);
+
+    const auto noisy = noisyPair(0.05);
+    SwitchingSimulation::Config a = noisy, b = noisy;
+    a.mode = SwitchingSimulation::Mode::Full;
+    b.mode = SwitchingSimulation::Mode::Incremental;
+    EXPECT_EQ(SwitchingSimulation(a).run().switches, SwitchingSimulation(b).run().switches);
+}
+
+// Verifies: REQ-F-SYNC-001
+// TEST-SYNC-SIM-004: Generated scenarios are deterministic with ordered schedules; JSON report
+TEST(SwitchingSimulationTests, GeneratorAndJson) {
+    SwitchingSimulation::Scenario s;
+    s.sourceCount = 8;
+    s.durationNs = 3'600'000'000'000ULL;
+    s.dropoutsPerHour = 5.0;
+    s.degradationsPerHour = 5.0;
+    const auto c1 = SwitchingSimulation::generate(s);
+    const auto c2 = SwitchingSimulation::generate(s);
+    size_t windows = 0;
+    for (size_t i = 0; i < c1.sources.size(); ++i) {
+        EXPECT_EQ(c1.sources[i].quality, c2.sources[i].quality);
+        const auto& d = c1.sources[i].dropouts;
+        for (size_t k = 0; k < d.size(); ++k) {
+            EXPECT_LT(d[k].startNs, d[k].endNs);
+            EXPECT_LE(d[k].endNs, s.durationNs);
+            if (k) {
+                EXPECT_LE(d[k - 1].endNs, d[k].startNs);
+            }
+        }
+        windows += d.size() + c1.sources[i].degradations.size();
+    }
+    EXPECT_GT(windows, 20u);
+
+    auto cfg = c1;
+    cfg.durationNs = 1'000'000'000ULL;
+    const std::string json = to_json(SwitchingSimulation(cfg).run(), cfg.mode, cfg.hysteresisMargin);
+    EXPECT_EQ(json.front(), '{');
+    EXPECT_EQ(json.back(), '}');
+    for (const char* key : {"\"switches\":", "\"suboptimal_fraction\":", "\"p99\":", "\"selections_per_second\":",
+                            "\"mode\":\"incremental\"", "\"selections\":10,"}) {
+        EXPECT_NE(json.find(key), std::string::npos) << key;
+    }
+}
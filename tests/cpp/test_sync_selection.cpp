@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
-#include "../../lib/Standards/AES/AES11/2009/sync/synchronization_manager.hpp"
+#include "../../lib/Standards/AES/AES11/2009/sync/scoring_policies.hpp"
+#include "../../lib/Standards/Common/reliability/metrics.hpp"
+#include <algorithm>
 
 using AES::AES11::_2009::sync::SynchronizationManager;
 using AES::AES11::_2009::sync::SourceMetrics;
@@ -120,3 +122,232 @@ TEST(SyncSelectionTests, ImprovementGreaterThanMarginSwitches) {
 }
 
 
+
+// Verifies: REQ-F-SYNC-001
+// TEST-SYNC-SELECT-008: Incremental update_source()/best() selects exactly as select()
+// over the full vector, hysteresis included
+TEST(SyncSelectionTests, IncrementalMatchesFullScan) {
+    constexpr size_t kSources = 300;
+    SynchronizationManager full(0.05);
+    SynchronizationManager incremental(0.05);
+    std::vector<SourceMetrics> sources(kSources);
+    uint64_t rng = 12345;
+    auto next = [&rng]() {
+        rng = rng * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<double>(rng >> 11) * (1.0 / 9007199254740992.0);
+    };
+    for (size_t i = 0; i < kSources; ++i) {
+        sources[i] = {next() * 0.2, 4.0 + next() * 2.0, next() < 0.1};
+        incremental.update_source(i, sources[i]);
+    }
+    ASSERT_EQ(incremental.best(), full.select(sources));
+    size_t switches = 0;
+    for (int step = 0; step < 5000; ++step) {
+        const size_t id = static_cast<size_t>(next() * kSources);
+        sources[id] = {next() * 0.2, 4.0 + next() * 2.0, next() < 0.1};
+        incremental.update_source(id, sources[id]);
+        const size_t before = full.current();
+        const size_t expected = full.select(sources);
+        if (expected != before) ++switches;
+        ASSERT_EQ(incremental.best(), expected) << "step " << step;
+    }
+    EXPECT_GT(switches, 0u);
+    EXPECT_EQ(incremental.source_count(), kSources);
+}
+
+// Verifies: REQ-F-SYNC-001
+// TEST-SYNC-SELECT-009: Removing the current source switches; sparse ids grow storage
+TEST(SyncSelectionTests, IncrementalRemoveAndSparseIds) {
+    SynchronizationManager mgr(0.5);
+    EXPECT_EQ(mgr.best(), SynchronizationManager::invalidIndex());
+    mgr.update_source(7, {0.1, 5.0, false});  // 4.9
+    EXPECT_EQ(mgr.best(), 7u);
+    mgr.update_source(2, {0.1, 5.3, false});  // 5.2: within margin, hold 7
+    EXPECT_EQ(mgr.best(), 7u);
+    EXPECT_EQ(mgr.best_candidate(), 2u);
+    mgr.update_source(40, {0.1, 6.0, false}); // 5.9: beyond margin
+    EXPECT_EQ(mgr.best(), 40u);
+    EXPECT_EQ(mgr.source_count(), 41u);
+    mgr.remove_source(40);
+    EXPECT_EQ(mgr.best(), 2u);
+    mgr.remove_source(2);
+    mgr.remove_source(7);
+    EXPECT_EQ(mgr.best(), SynchronizationManager::invalidIndex());
+    mgr.update_source(0, {0.0, 1.0, true});
+    EXPECT_EQ(mgr.best(), 0u);
+}
+
+// Verifies: REQ-F-SYNC-001
+// TEST-SYNC-SELECT-010: Ranked backup list stays an exact top-k prefix under updates
+TEST(SyncSelectionTests, BackupRankingIsExactPrefix) {
+    constexpr size_t kSources = 200;
+    SynchronizationManager mgr(0.05);
+    std::vector<SourceMetrics> sources(kSources);
+    std::vector<bool> active(kSources, false);
+    uint64_t rng = 99;
+    auto next = [&rng]() {
+        rng = rng * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<double>(rng >> 11) * (1.0 / 9007199254740992.0);
+    };
+    auto score = [&](size_t i) {
+        return sources[i].quality - sources[i].stability - (sources[i].degraded ? 10.0 : 0.0);
+    };
+    for (int step = 0; step < 4000; ++step) {
+        const size_t id = static_cast<size_t>(next() * kSources);
+        if (next() < 0.1) {
+            mgr.remove_source(id);
+            active[id] = false;
+        } else {
+            sources[id] = {next() * 0.2, 4.0 + next() * 2.0, next() < 0.1};
+            mgr.update_source(id, sources[id]);
+            active[id] = true;
+        }
+        std::vector<size_t> ranked;
+        for (size_t i = 0; i < kSources; ++i) if (active[i]) ranked.push_back(i);
+        std::stable_sort(ranked.begin(), ranked.end(), [&](size_t a, size_t b) { return score(a) > score(b); });
+        const auto& backups = mgr.backups();
+        ASSERT_LE(backups.size(), SynchronizationManager::kDefaultBackupDepth);
+        ASSERT_GE(backups.size(), std::min(ranked.size(), SynchronizationManager::kDefaultBackupDepth / 2));
+        for (size_t k = 0; k < backups.size(); ++k) ASSERT_EQ(backups[k], ranked[k]) << "step " << step;
+    }
+}
+
+// Verifies: REQ-F-SYNC-001, REQ-NF-PERF-001
+// TEST-SYNC-SELECT-011: failover() switches to the top backup, records latency and
+// prevents switching back
+TEST(SyncSelectionTests, FailoverSwitchesToRankedBackup) {
+    class StepClock : public Common::interfaces::ClockInterface {
+    public:
+        uint64_t get_tick() override { return _t; }
+        uint64_t get_time_ns() override { return _t; }
+        Common::interfaces::TickTimePair get_tick_time_pair() override {
+            _t += 7; // each snapshot advances 7 ns
+            return {_t, _t, 0};
+        }
+
+    private:
+        uint64_t _t = 0;
+    };
+    Common::reliability::ReliabilityMetrics::resetForTesting();
+    StepClock clk;
+    AES::AES11::_2009::core::TimingSnapshotService<> timing(clk);
+    SynchronizationManager mgr(0.5);
+    mgr.attach_timing(&timing);
+    for (size_t i = 0; i < 16; ++i) mgr.update_source(i, {0.0, 1.0 + 0.1 * static_cast<double>(i), false});
+    ASSERT_EQ(mgr.best(), 15u);
+    EXPECT_EQ(mgr.failover(3), 15u) << "Degrading a backup keeps the current reference";
+    EXPECT_EQ(mgr.failover(15), 14u);
+    EXPECT_EQ(mgr.best(), 14u) << "Penalised source must not win back via hysteresis";
+    EXPECT_EQ(mgr.failover(15), 14u) << "Already failed over";
+    EXPECT_EQ(mgr.failover(14), 13u);
+    const auto& fm = mgr.failover_metrics();
+    EXPECT_EQ(fm.count, 2u);
+    EXPECT_EQ(fm.lastLatencyNs, 7u);
+    EXPECT_EQ(fm.maxLatencyNs, 7u);
+    EXPECT_DOUBLE_EQ(fm.meanLatencyNs(), 7.0);
+    const auto rm = Common::reliability::ReliabilityMetrics::snapshot();
+    EXPECT_EQ(rm.sourceFailovers, 2u);
+    EXPECT_EQ(rm.maxFailoverLatencyNs, 7u);
+    // A recovered source re-enters the ranking through update_source().
+    mgr.update_source(15, {0.0, 9.0, false});
+    EXPECT_EQ(mgr.backups().front(), 15u);
+    EXPECT_EQ(mgr.best(), 15u);
+}
+
+namespace {
+using AES::AES11::_2009::core::CaptureRange;
+using AES::AES11::_2009::core::DARSGrade;
+using AES::AES11::_2009::sync::BasicSynchronizationManager;
+using AES::AES11::_2009::sync::ChannelStatusGradeScoringPolicy;
+using AES::AES11::_2009::sync::DefaultScoringPolicy;
+using AES::AES11::_2009::sync::MtieScoringPolicy;
+using AES::AES11::_2009::sync::PpmErrorScoringPolicy;
+
+using AES::AES11::_2009::sync::ExtendedSourceMetrics;
+
+ExtendedSourceMetrics with(double stability, double quality, double mtieNs, double ppm, DARSGrade grade) {
+    ExtendedSourceMetrics m{};
+    m.stability = stability;
+    m.quality = quality;
+    m.mtieNs = mtieNs;
+    m.ppmError = ppm;
+    m.grade = grade;
+    return m;
+}
+} // namespace
+
+static_assert(std::is_same<SynchronizationManager, BasicSynchronizationManager<DefaultScoringPolicy>>::value,
+              "Default manager keeps the original scoring");
+
+// Verifies: REQ-F-SYNC-001
+// TEST-SYNC-SELECT-012: MTIE policy prefers low wander over short-term stability
+TEST(SyncSelectionTests, MtiePolicyPrefersLowWander) {
+    std::vector<ExtendedSourceMetrics> sources = {with(0.01, 5.0, 400.0, 0.0, DARSGrade::Unknown),
+                                                  with(0.30, 5.0, 50.0, 0.0, DARSGrade::Unknown)};
+    SynchronizationManager byDefault(0.1);
+    EXPECT_EQ(byDefault.select({sources[0], sources[1]}), 0u);
+    BasicSynchronizationManager<MtieScoringPolicy> byMtie(0.1);
+    EXPECT_EQ(byMtie.select(sources), 1u); // 5.0 - 0.5 beats 5.0 - 4.0
+}
+
+// Verifies: REQ-F-SYNC-001, REQ-F-DARS-003
+// TEST-SYNC-SELECT-013: ppm policy penalises sources outside the grade capture range
+TEST(SyncSelectionTests, PpmPolicyUsesCaptureRange) {
+    std::vector<ExtendedSourceMetrics> sources = {with(0.0, 6.0, 0.0, 3.0, DARSGrade::Grade1),
+                                                  with(0.0, 5.0, 0.0, -1.0, DARSGrade::Grade1)};
+    BasicSynchronizationManager<PpmErrorScoringPolicy> grade1(0.1, PpmErrorScoringPolicy(CaptureRange::Grade::Grade1));
+    EXPECT_EQ(grade1.select(sources), 1u) << "3 ppm is outside the Grade 1 capture range";
+    BasicSynchronizationManager<PpmErrorScoringPolicy> grade2(0.1, PpmErrorScoringPolicy(CaptureRange::Grade::Grade2));
+    EXPECT_EQ(grade2.select(sources), 0u);
+    EXPECT_DOUBLE_EQ(grade2.policy().captureLimitPpm, CaptureRange::capture_limit_ppm(CaptureRange::Grade::Grade2));
+}
+
+// Verifies: REQ-F-SYNC-001, REQ-F-DARS-002
+// TEST-SYNC-SELECT-014: Grade policy prefers Grade 1 and works with the incremental path
+TEST(SyncSelectionTests, GradePolicyIncrementalAndFailover) {
+    BasicSynchronizationManager<ChannelStatusGradeScoringPolicy> mgr(0.1);
+    mgr.update_source(0, with(0.0, 5.0, 0.0, 0.0, DARSGrade::Grade2));
+    mgr.update_source(1, with(0.0, 4.8, 0.0, 0.0, DARSGrade::Grade1));
+    mgr.update_source(2, with(0.0, 9.0, 0.0, 0.0, DARSGrade::Reserved));
+    EXPECT_EQ(mgr.best(), 1u);
+    EXPECT_EQ(mgr.failover(1), 0u);
+    EXPECT_EQ(mgr.best(), 0u) << "Failover rescoring goes through the policy";
+}
+
+// Verifies: REQ-F-SYNC-001, REQ-NF-PERF-001
+// TEST-SYNC-SELECT-015: Backup refill from the tree is exact for any depth and source
+// count, and failover latency can be timed with a concrete (non-virtual) clock
+TEST(SyncSelectionTests, BackupRefillAndConcreteClockTiming) {
+    struct CountingClock {
+        uint64_t t = 0;
+        uint64_t get_tick() { return ++t; }
+        uint64_t get_time_ns() { return t * 5; }
+    };
+    constexpr size_t kSources = 37; // not a power of two: leaves padded with inactive slots
+    SynchronizationManager mgr(0.05);
+    for (size_t i = 0; i < kSources; ++i) {
+        if (i % 5 == 0) continue; // inactive holes between active leaves
+        mgr.update_source(i, {0.0, static_cast<double>((i * 17) % kSources), false});
+    }
+    std::vector<size_t> ranked;
+    for (size_t i = 0; i < kSources; ++i) if (i % 5 != 0) ranked.push_back(i);
+    std::stable_sort(ranked.begin(), ranked.end(),
+                     [](size_t a, size_t b) { return (a * 17) % kSources > (b * 17) % kSources; });
+    for (size_t depth : {2u, 5u, 16u, 64u}) {
+        mgr.set_backup_depth(depth);
+        const auto& backups = mgr.backups();
+        ASSERT_EQ(backups.size(), std::min(depth, ranked.size())) << "depth " << depth;
+        for (size_t k = 0; k < backups.size(); ++k) EXPECT_EQ(backups[k], ranked[k]) << "depth " << depth;
+    }
+
+    CountingClock clk;
+    AES::AES11::_2009::core::TimingSnapshotService<CountingClock> timing(clk);
+    mgr.attach_timing(&timing);
+    const size_t top = mgr.best();
+    ASSERT_EQ(top, ranked[0]);
+    EXPECT_EQ(mgr.failover(top), ranked[1]);
+    EXPECT_GT(mgr.failover_metrics().lastLatencyNs, 0u);
+    mgr.attach_timing(nullptr);
+    EXPECT_EQ(mgr.failover(ranked[1]), ranked[2]);
+    EXPECT_EQ(mgr.failover_metrics().lastLatencyNs, 0u) << "Detached timing records no latency";
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include "../../lib/Standards/AES/AES11/2009/core/tick_calibrator.hpp"
+#include <atomic>
+#include <thread>
+
+using AES::AES11::_2009::core::TickCalibrationWorker;
+using AES::AES11::_2009::core::TickCalibrator;
+using AES::AES11::_2009::core::TickConversion;
+using AES::AES11::_2009::core::TimingSnapshot;
+using AES::AES11::_2009::core::TimingSnapshotService;
+using Common::concurrency::Seqlock;
+
+// Verifies: REQ-NF-PERF-001
+// TEST-UNIT-TickCal-001: Regression recovers a 3.2 GHz tick rate and converts within 1 ns
+TEST(TickCalibratorTests, FitsCycleCounterRate) {
+    TickCalibrator cal(32);
+    const uint64_t tick0 = 5'000'000'000'000ULL;
+    const uint64_t ns0 = 1'000'000'000'000ULL;
+    const int jitterNs[4] = {0, 3, -2, 1};
+    for (uint64_t i = 0; i < 32; ++i) {
+        const uint64_t ticks = i * 32'000'000ULL; // 10 ms apart at 3.2 GHz
+        cal.addSample(TimingSnapshot{tick0 + ticks, ns0 + ticks * 10 / 32 + jitterNs[i % 4], i, 0});
+    }
+    ASSERT_TRUE(cal.recalibrate());
+    TickConversion c = cal.conversion();
+    EXPECT_EQ(c.generation, 1u);
+    EXPECT_NEAR(c.ns_per_tick(), 0.3125, 1e-9);
+    // Convert a tick 1 s past the last sample.
+    const uint64_t last = tick0 + 31 * 32'000'000ULL;
+    const uint64_t t = last + 3'200'000'000ULL;
+    const int64_t expected = static_cast<int64_t>(ns0 + (t - tick0) * 10 / 32);
+    EXPECT_NEAR(static_cast<double>(static_cast<int64_t>(cal.to_ns(t)) - expected), 0.0, 3.0);
+}
+
+// Verifies: REQ-NF-PERF-001
+// TEST-UNIT-TickCal-002: Insufficient or degenerate samples keep the previous conversion
+TEST(TickCalibratorTests, DegenerateInputKeepsPrevious) {
+    TickCalibrator cal(4);
+    EXPECT_FALSE(cal.recalibrate());
+    cal.addSample(TimingSnapshot{100, 1000, 1, 0});
+    cal.addSample(TimingSnapshot{100, 2000, 2, 0}); // same tick: no slope
+    EXPECT_FALSE(cal.recalibrate());
+    EXPECT_EQ(cal.conversion().generation, 0u);
+}
+
+// Verifies: REQ-NF-PERF-001
+// TEST-UNIT-Seqlock-001: Readers never observe a torn value while a writer publishes
+TEST(SeqlockTests, ReadersSeeConsistentValues) {
+    struct Pair {
+        uint64_t a;
+        uint64_t b;
+    };
+    Seqlock<Pair> lock(Pair{0, 0});
+    std::atomic<bool> done{false};
+    std::atomic<bool> torn{false};
+    std::thread reader([&]() {
+        while (!done.load()) {
+            Pair p = lock.load();
+            if (p.b != p.a * 3) torn = true;
+        }
+    });
+    for (uint64_t i = 1; i <= 20000; ++i) lock.store(Pair{i, i * 3});
+    done = true;
+    reader.join();
+    EXPECT_FALSE(torn.load());
+    EXPECT_EQ(lock.load().a, 20000u);
+}
+
+// Verifies: REQ-NF-PERF-001
+// TEST-UNIT-TickCal-003: Background worker recalibrates from a snapshot service
+TEST(TickCalibratorTests, BackgroundWorkerPublishes) {
+    struct TwoNsPerTick {
+        uint64_t get_tick() { return tick.fetch_add(1000) + 1000; }
+        uint64_t get_time_ns() { return tick.load() * 2; }
+        Common::interfaces::TickTimePair get_tick_time_pair() {
+            const uint64_t t = tick.fetch_add(1000) + 1000;
+            return {t, t * 2, 0};
+        }
+        std::atomic<uint64_t> tick{0};
+    };
+    TwoNsPerTick clk;
+    TimingSnapshotService svc(clk);
+    TickCalibrator cal(16);
+    TickCalibrationWorker<TwoNsPerTick> worker(svc, cal, std::chrono::microseconds(100));
+    worker.start();
+    while (cal.conversion().generation < 3) std::this_thread::yield();
+    worker.stop();
+    EXPECT_GE(worker.cycles(), 3u);
+    EXPECT_NEAR(cal.conversion().ns_per_tick(), 2.0, 1e-9);
+    EXPECT_EQ(cal.to_ns(5'000'000), 10'000'000u);
+}
+
+// Verifies: REQ-NF-PERF-001
+// TEST-UNIT-TickCal-004: A tick captured before a recalibration converts against the new anchor
+TEST(TickCalibratorTests, ConvertsTickBeforeAnchor) {
+    TickCalibrator cal(8);
+    const uint64_t tick0 = 7'000'000'000ULL;
+    const uint64_t ns0 = 2'000'000'000ULL;
+    for (uint64_t i = 0; i < 4; ++i) cal.addSample(TimingSnapshot{tick0 + i * 3'000'000, ns0 + i * 1'000'000, i, 0});
+    ASSERT_TRUE(cal.recalibrate());
+    const uint64_t captured = tick0 + 4'500'000; // between samples 1 and 2
+    const uint64_t before = cal.to_ns(captured);
+    EXPECT_NEAR(static_cast<double>(before), static_cast<double>(ns0 + 1'500'000), 1.0);
+
+    // Re-anchor well past the captured tick, then convert it again.
+    for (uint64_t i = 4; i < 12; ++i) cal.addSample(TimingSnapshot{tick0 + i * 3'000'000, ns0 + i * 1'000'000, i, 0});
+    ASSERT_TRUE(cal.recalibrate());
+    ASSERT_LT(captured, cal.conversion().baseTick);
+    EXPECT_NEAR(static_cast<double>(cal.to_ns(captured)), static_cast<double>(before), 1.0);
+    EXPECT_NEAR(static_cast<double>(cal.to_ns(tick0)), static_cast<double>(ns0), 1.0);
+}
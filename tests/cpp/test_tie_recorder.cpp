@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include "../../lib/Standards/AES/AES11/2009/sync/tie_recorder.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using AES::AES11::_2009::core::PhaseOffset;
+using AES::AES11::_2009::sync::TieRecorder;
+
+namespace {
+
+// Slow wander (drift + sinusoid-like ramp) quantized to 1 ns, optionally with jitter.
+std::vector<int64_t> makeTie(size_t n, int jitterNs, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<int> jitter(-jitterNs, jitterNs);
+    std::vector<int64_t> v(n);
+    double phase = 0.0, freq = 0.002; // ns per TRP
+    for (size_t i = 0; i < n; ++i) {
+        if (i % 50'000 == 0) freq = -freq * 0.7;
+        phase += freq;
+        v[i] = static_cast<int64_t>(phase >= 0 ? phase + 0.5 : phase - 0.5) + (jitterNs ? jitter(rng) : 0);
+    }
+    return v;
+}
+
+} // namespace
+
+// Verifies: REQ-F-DARS-006
+// TEST-TIE-REC-001: Any range decodes to the recorded values
+TEST(TieRecorderTests, RoundTripsArbitraryRanges) {
+    for (size_t block : {size_t{1}, size_t{7}, size_t{4096}}) {
+        TieRecorder rec(TieRecorder::Config{block});
+        std::vector<int64_t> tie = makeTie(30'000, 3, block);
+        // Steps, extremes and clamping.
+        tie[100] += 1'000'000;
+        tie[20'000] = int64_t{1} << 62;
+        tie[20'001] = -(int64_t{1} << 62);
+        rec.append(tie.data(), tie.size());
+        tie[20'000] = TieRecorder::kMaxAbsTieNs;
+        tie[20'001] = -TieRecorder::kMaxAbsTieNs;
+        ASSERT_EQ(rec.size(), tie.size());
+
+        std::vector<int64_t> out(tie.size());
+        ASSERT_EQ(rec.decode(0, out.data(), out.size()), tie.size());
+        EXPECT_EQ(out, tie) << block;
+
+        std::mt19937_64 rng(block);
+        for (int i = 0; i < 200; ++i) {
+            const uint64_t first = rng() % tie.size();
+            const size_t count = static_cast<size_t>(rng() % 5'000);
+            const size_t expected = std::min<size_t>(count, tie.size() - first);
+            std::vector<int64_t> part(count, -1);
+            ASSERT_EQ(rec.decode(first, part.data(), count), expected);
+            ASSERT_TRUE(std::equal(part.begin(), part.begin() + expected, tie.begin() + first))
+                << block << " " << first << " " << count;
+        }
+        EXPECT_EQ(rec.decode(tie.size(), out.data(), 10), 0u);
+    }
+
+    // Alternating extremes give the largest delta-of-delta of either sign (+/-2^61 after
+    // clamping); the sequence must survive even when the inputs exceed the clamp.
+    for (int64_t big : {TieRecorder::kMaxAbsTieNs, int64_t{1} << 60}) {
+        TieRecorder rec(TieRecorder::Config{64});
+        const int64_t seq[4] = {big, -big, big, 0};
+        rec.append(seq, 4);
+        const int64_t m = TieRecorder::kMaxAbsTieNs;
+        const int64_t expected[4] = {m, -m, m, 0};
+        int64_t out[4] = {};
+        ASSERT_EQ(rec.decode(0, out, 4), 4u);
+        for (int i = 0; i < 4; ++i) EXPECT_EQ(out[i], expected[i]) << big << " " << i;
+    }
+}
+
+// Verifies: REQ-F-DARS-006
+// TEST-TIE-REC-002: Slowly varying TIE compresses far below one byte per TRP
+TEST(TieRecorderTests, CompressesSlowWander) {
+    const std::vector<int64_t> tie = makeTie(2'000'000, 0, 1);
+    TieRecorder rec;
+    rec.append(tie.data(), tie.size());
+    // One 1 ns step every ~500 TRPs costs two literals; the rest is runs.
+    EXPECT_LT(rec.bits_per_sample(), 0.2);
+
+    // Jitter of a few ns still fits one byte per TRP.
+    const std::vector<int64_t> noisy = makeTie(200'000, 4, 2);
+    TieRecorder jittery;
+    jittery.append(noisy.data(), noisy.size());
+    EXPECT_LE(jittery.bits_per_sample(), 8.1);
+
+    // Constant drift is one run per block.
+    TieRecorder ramp;
+    for (int64_t i = 0; i < 1'000'000; ++i) ramp.append(-3 * i);
+    EXPECT_LT(ramp.bytes(), 16 * 32u);
+    int64_t last = 0;
+    ASSERT_EQ(ramp.decode(999'999, &last, 1), 1u);
+    EXPECT_EQ(last, -2'999'997);
+}
+
+// Verifies: REQ-F-DARS-006
+// TEST-TIE-REC-003: Cursor streams a range in chunks for windowed MTIE analysis
+TEST(TieRecorderTests, CursorStreamsIntoMtie) {
+    const std::vector<int64_t> tie = makeTie(300'000, 2, 3);
+    TieRecorder rec(TieRecorder::Config{10'000});
+    rec.append(tie.data(), tie.size());
+
+    // MTIE over non-overlapping 1000-sample windows of [12345, 12345 + 250000).
+    const uint64_t first = 12'345;
+    const size_t total = 250'000, window = 1'000;
+    auto mtie = [&](auto&& next) {
+        int64_t best = 0;
+        for (size_t w = 0; w < total / window; ++w) {
+            int64_t lo = INT64_MAX, hi = INT64_MIN;
+            for (size_t i = 0; i < window; ++i) {
+                const int64_t v = next();
+                lo = std::min(lo, v);
+                hi = std::max(hi, v);
+            }
+            best = std::max(best, hi - lo);
+        }
+        return best;
+    };
+    size_t idx = first;
+    const int64_t direct = mtie([&] { return tie[idx++]; });
+
+    TieRecorder::Cursor c = rec.cursor(first);
+    int64_t chunk[333];
+    size_t have = 0, at = 0;
+    const int64_t streamed = mtie([&] {
+        if (at == have) {
+            have = c.read(chunk, 333);
+            at = 0;
+        }
+        return chunk[at++];
+    });
+    EXPECT_EQ(streamed, direct);
+    EXPECT_EQ(c.position(), first + total + (have - at));
+    EXPECT_GT(direct, 0);
+}
+
+// Verifies: REQ-F-DARS-006
+// TEST-TIE-REC-004: Frame-phase offsets are recorded rounded to the nearest ns
+TEST(TieRecorderTests, RecordsPhaseOffsets) {
+    TieRecorder rec;
+    rec.append(PhaseOffset::from_ns(2.0 / 3.0));
+    rec.append(PhaseOffset::from_ns(-2.0 / 3.0));
+    rec.append(PhaseOffset::from_ns(1.5));
+    rec.append(PhaseOffset::from_ns(-1.5));
+    rec.append(PhaseOffset::from_ns(-0.25));
+    int64_t out[5] = {};
+    ASSERT_EQ(rec.decode(0, out, 5), 5u);
+    EXPECT_EQ(out[0], 1);
+    EXPECT_EQ(out[1], -1);
+    EXPECT_EQ(out[2], 2);
+    EXPECT_EQ(out[3], -2);
+    EXPECT_EQ(out[4], 0);
+
+    rec.clear();
+    EXPECT_TRUE(rec.empty());
+    EXPECT_EQ(rec.bytes(), 0u);
+    EXPECT_TRUE(rec.cursor(0).done());
+}
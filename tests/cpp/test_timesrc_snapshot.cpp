@@ -6,6 +6,8 @@
 #include <atomic>
 #include <algorithm>
 #include <mutex>
+#include <iterator>
+#include <type_traits>
 
 // Simple mock clock providing deterministic monotonic behavior
 class MockClock : public Common::interfaces::ClockInterface {
@@ -103,3 +105,207 @@ TEST(TimingSnapshotServiceTests, ConcurrentSnapshotsYieldUniqueSequences) {
     seqs.erase(std::unique(seqs.begin(), seqs.end()), seqs.end());
     EXPECT_EQ(seqs.size(), static_cast<size_t>(threads * perThread));
 }
+
+// Non-virtual clock used to exercise the devirtualized service path
+struct InlineCounterClock {
+    uint64_t get_tick() { return ++tick_; }
+    uint64_t get_time_ns() { return tick_ * 1'000ULL; }
+    uint64_t tick_ = 0;
+};
+
+// Verifies: REQ-NF-REL-004, REQ-NF-PERF-001
+// TEST-TIMESRC-SNAPSHOT-005: Template deduction keeps the virtual adapter for ClockInterface
+// clocks and devirtualizes concrete clocks, with identical snapshot semantics
+TEST(TimingSnapshotServiceTests, TemplatedServiceDeduction) {
+    using AES::AES11::_2009::core::TimingSnapshotService;
+    MockClock virt;
+    InlineCounterClock inl;
+    TimingSnapshotService a(virt);
+    TimingSnapshotService b(inl);
+    static_assert(std::is_same<decltype(a)::clock_type, Common::interfaces::ClockInterface>::value,
+                  "ClockInterface-derived clocks use the virtual adapter");
+    static_assert(std::is_same<decltype(b)::clock_type, InlineCounterClock>::value,
+                  "Concrete clocks are devirtualized");
+    auto s1 = b.snapshot();
+    auto s2 = b.snapshot();
+    EXPECT_EQ(s1.seq + 1, s2.seq);
+    EXPECT_EQ(s2.time_ns, s2.tick * 1'000ULL);
+    EXPECT_EQ(a.snapshot().seq, 1u);
+}
+
+// Verifies: REQ-NF-REL-004
+// TEST-TIMESRC-SNAPSHOT-006: Bracketed fallback retries past a preemption and reports
+// the tightest tick bracket as snapshot uncertainty
+TEST(TimingSnapshotServiceTests, BracketedPairRejectsPreemptedRead) {
+    // Tick advances by 1 per read, except one read that simulates a 1000-tick preemption.
+    class PreemptedClock : public Common::interfaces::ClockInterface {
+    public:
+        uint64_t get_tick() override {
+            tick_ += (++reads_ == 2) ? 1000 : 1;
+            return tick_;
+        }
+        uint64_t get_time_ns() override { return tick_ * 10; }
+
+    private:
+        uint64_t tick_ = 0;
+        int reads_ = 0;
+    };
+    PreemptedClock clk;
+    AES::AES11::_2009::core::TimingSnapshotService svc(clk);
+    auto s = svc.snapshot();
+    // Attempt 1: ticks 1 .. 1001 (wide) -> retried; attempt 2: 1002 .. 1003 (width 1).
+    EXPECT_EQ(s.tick, 1002u);
+    EXPECT_EQ(s.time_ns, 10020u);
+    EXPECT_EQ(s.uncertainty_ticks, 1u);
+}
+
+// Verifies: REQ-NF-REL-004
+// TEST-TIMESRC-SNAPSHOT-007: Native paired read is used when the clock provides one
+TEST(TimingSnapshotServiceTests, NativePairedReadHasZeroUncertainty) {
+    struct PairedClock {
+        uint64_t get_tick() { return ++calls; }
+        uint64_t get_time_ns() { return ++calls; }
+        Common::interfaces::TickTimePair get_tick_time_pair() { return {42, 4200, 0}; }
+        uint64_t calls = 0;
+    };
+    PairedClock clk;
+    AES::AES11::_2009::core::TimingSnapshotService svc(clk);
+    auto s = svc.snapshot();
+    EXPECT_EQ(s.tick, 42u);
+    EXPECT_EQ(s.time_ns, 4200u);
+    EXPECT_EQ(s.uncertainty_ticks, 0u);
+    EXPECT_EQ(clk.calls, 0u) << "Separate reads must not be issued";
+}
+
+// Verifies: REQ-NF-REL-004, REQ-NF-PERF-001
+// TEST-TIMESRC-SNAPSHOT-008: Leased sequence blocks stay unique across threads, increase
+// per thread, and merge into one total order
+TEST(TimingSnapshotServiceTests, LeasedSequencesUniqueAndMergeable) {
+    struct StepClock {
+        std::atomic<uint64_t> t{0};
+        Common::interfaces::TickTimePair get_tick_time_pair() {
+            const uint64_t v = t.fetch_add(1) + 1;
+            return {v, v * 10, 0};
+        }
+        uint64_t get_tick() { return t.load(); }
+        uint64_t get_time_ns() { return t.load() * 10; }
+    };
+    StepClock clk;
+    AES::AES11::_2009::core::TimingSnapshotService svc(clk, 8);
+    constexpr int threads = 4;
+    constexpr int perThread = 100;
+    std::vector<std::vector<AES::AES11::_2009::core::TimingSnapshot>> perThreadSnaps(threads);
+    std::vector<std::thread> ts;
+    for (int i = 0; i < threads; ++i) {
+        ts.emplace_back([&, i]() {
+            AES::AES11::_2009::core::SequenceLease lease;
+            for (int k = 0; k < perThread; ++k) perThreadSnaps[i].push_back(svc.snapshot(lease));
+        });
+    }
+    for (auto& t : ts) t.join();
+
+    std::vector<AES::AES11::_2009::core::TimingSnapshot> merged;
+    for (auto& v : perThreadSnaps) {
+        for (size_t k = 1; k < v.size(); ++k) ASSERT_LT(v[k - 1].seq, v[k].seq);
+        std::vector<AES::AES11::_2009::core::TimingSnapshot> out;
+        std::merge(merged.begin(), merged.end(), v.begin(), v.end(), std::back_inserter(out),
+                   AES::AES11::_2009::core::TimingSnapshotOrder{});
+        merged.swap(out);
+    }
+    ASSERT_EQ(merged.size(), static_cast<size_t>(threads * perThread));
+    std::vector<uint64_t> seqs;
+    for (size_t k = 0; k < merged.size(); ++k) {
+        if (k > 0) {
+            EXPECT_TRUE(AES::AES11::_2009::core::TimingSnapshotOrder{}(merged[k - 1], merged[k]));
+        }
+        seqs.push_back(merged[k].seq);
+    }
+    std::sort(seqs.begin(), seqs.end());
+    EXPECT_EQ(std::unique(seqs.begin(), seqs.end()), seqs.end());
+    // Shared-counter snapshots interleave without colliding with leased blocks.
+    auto shared = svc.snapshot();
+    EXPECT_FALSE(std::binary_search(seqs.begin(), seqs.end(), shared.seq));
+}
+
+// Verifies: REQ-NF-REL-004, REQ-NF-PERF-001
+// TEST-TIMESRC-SNAPSHOT-009: Batch capture reserves one consecutive sequence range and
+// reads the backend in batches
+TEST(TimingSnapshotServiceTests, BatchCaptureFillsCallerBuffer) {
+    class BatchCountingClock : public Common::interfaces::ClockInterface {
+    public:
+        uint64_t get_tick() override { return _t; }
+        uint64_t get_time_ns() override { return _t * 100; }
+        Common::interfaces::TickTimePair get_tick_time_pair() override {
+            ++_t;
+            return {_t, _t * 100, 0};
+        }
+        void get_tick_time_pairs(Common::interfaces::TickTimePair* out, size_t count) override {
+            ++batchCalls;
+            ClockInterface::get_tick_time_pairs(out, count);
+        }
+        int batchCalls = 0;
+
+    private:
+        uint64_t _t = 0;
+    };
+    using Service = AES::AES11::_2009::core::TimingSnapshotService<>;
+    BatchCountingClock clk;
+    Service svc(clk);
+    const auto before = svc.snapshot();
+    const size_t count = 2 * Service::kBatchChunk + 10; // spans three backend batches
+    std::vector<AES::AES11::_2009::core::TimingSnapshot> buf(count);
+    ASSERT_EQ(svc.snapshot_batch(buf.data(), buf.size()), count);
+    EXPECT_EQ(clk.batchCalls, 3);
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(buf[i].seq, before.seq + 1 + i);
+        EXPECT_EQ(buf[i].tick, before.tick + 1 + i);
+        EXPECT_EQ(buf[i].time_ns, buf[i].tick * 100);
+    }
+    EXPECT_EQ(svc.snapshot().seq, before.seq + count + 1);
+    EXPECT_EQ(svc.snapshot_batch(buf.data(), 0), 0u);
+    EXPECT_EQ(svc.snapshot_batch(nullptr, 4), 0u);
+    EXPECT_EQ(svc.snapshot().seq, before.seq + count + 2) << "Empty batches reserve nothing";
+}
+
+// Verifies: REQ-NF-REL-004
+// TEST-TIMESRC-SNAPSHOT-010: Concurrent batches never share sequence numbers
+TEST(TimingSnapshotServiceTests, ConcurrentBatchesUniqueSequences) {
+    struct NativeBatchClock {
+        std::atomic<uint64_t> t{0};
+        Common::interfaces::TickTimePair get_tick_time_pair() {
+            const uint64_t v = t.fetch_add(1) + 1;
+            return {v, v, 0};
+        }
+        void get_tick_time_pairs(Common::interfaces::TickTimePair* out, size_t count) {
+            const uint64_t base = t.fetch_add(count) + 1; // one read for the whole burst
+            for (size_t i = 0; i < count; ++i) out[i] = {base + i, base + i, 0};
+        }
+        uint64_t get_tick() { return t.load(); }
+        uint64_t get_time_ns() { return t.load(); }
+    };
+    NativeBatchClock clk;
+    AES::AES11::_2009::core::TimingSnapshotService svc(clk);
+    constexpr int threads = 4;
+    constexpr int batches = 50;
+    constexpr size_t burst = 64;
+    std::vector<std::vector<uint64_t>> seqs(threads);
+    std::vector<std::thread> ts;
+    for (int i = 0; i < threads; ++i) {
+        ts.emplace_back([&, i]() {
+            AES::AES11::_2009::core::TimingSnapshot buf[burst];
+            for (int b = 0; b < batches; ++b) {
+                svc.snapshot_batch(buf, burst);
+                for (size_t k = 0; k < burst; ++k) seqs[i].push_back(buf[k].seq);
+            }
+        });
+    }
+    for (auto& t : ts) t.join();
+    std::vector<uint64_t> all;
+    for (auto& v : seqs) all.insert(all.end(), v.begin(), v.end());
+    std::sort(all.begin(), all.end());
+    EXPECT_EQ(all.size(), static_cast<size_t>(threads * batches) * burst);
+    EXPECT_EQ(std::unique(all.begin(), all.end()), all.end());
+    EXPECT_EQ(all.front(), 1u);
+    EXPECT_EQ(all.back(), all.size());
+    EXPECT_EQ(clk.t.load(), all.size()) << "Native batch read must replace per-element reads";
+}
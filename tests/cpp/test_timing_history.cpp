@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include "../../lib/Standards/AES/AES11/2009/core/timing_history.hpp"
+#include <cmath>
+#include <vector>
+
+using AES::AES11::_2009::core::TimingHistory;
+
+namespace {
+constexpr uint64_t kSec = 1'000'000'000ULL;
+}
+
+// Verifies: REQ-NF-PERF-003
+// TEST-DM-HISTORY-001: Merged buckets equal direct statistics over the same samples
+TEST(TimingHistoryTests, MergedBucketsMatchDirectStatistics) {
+    TimingHistory hist;
+    TimingHistory::Summary direct;
+    for (uint64_t i = 0; i < 600; ++i) {
+        const double x = std::sin(static_cast<double>(i)) * 10.0 + 100.0;
+        hist.record(i * kSec / 4, x); // 4 samples per second over 150 s
+        direct.add(x);
+    }
+    auto s = hist.query(0, 150 * kSec);
+    EXPECT_EQ(s.count, direct.count);
+    EXPECT_NEAR(s.mean, direct.mean, 1e-9);
+    EXPECT_NEAR(s.variance(), direct.variance(), 1e-9);
+    EXPECT_DOUBLE_EQ(s.min, direct.min);
+    EXPECT_DOUBLE_EQ(s.max, direct.max);
+    // Minute tier agrees with the second tier.
+    auto m = hist.queryTier(1, 0, 180 * kSec);
+    EXPECT_EQ(m.count, direct.count);
+    EXPECT_NEAR(m.variance(), direct.variance(), 1e-9);
+}
+
+// Verifies: REQ-NF-PERF-003
+// TEST-DM-HISTORY-002: Old ranges fall back to coarser tiers after fine tier wraps
+TEST(TimingHistoryTests, OldRangesServedByCoarserTier) {
+    TimingHistory hist({{{kSec, 10}, {10 * kSec, 10}, {100 * kSec, 10}}});
+    for (uint64_t t = 0; t < 200; ++t) {
+        hist.record(t * kSec, static_cast<double>(t < 50 ? 1.0 : 5.0));
+    }
+    // Seconds tier keeps only [190,200); minutes-equivalent keeps [100,200); top keeps all.
+    EXPECT_FALSE(hist.retains(0, 20 * kSec));
+    EXPECT_FALSE(hist.retains(1, 20 * kSec));
+    EXPECT_TRUE(hist.retains(2, 20 * kSec));
+    auto early = hist.query(0, 50 * kSec); // served by 100 s buckets -> includes [0,100)
+    EXPECT_EQ(early.count, 100u);
+    EXPECT_DOUBLE_EQ(early.min, 1.0);
+    EXPECT_DOUBLE_EQ(early.max, 5.0);
+    auto recent = hist.query(195 * kSec, 200 * kSec); // fine tier
+    EXPECT_EQ(recent.count, 5u);
+    EXPECT_DOUBLE_EQ(recent.mean, 5.0);
+    EXPECT_DOUBLE_EQ(recent.variance(), 0.0);
+}
+
+// Verifies: REQ-NF-PERF-003
+// TEST-DM-HISTORY-003: Ring reuse resets stale buckets; stale samples are ignored
+TEST(TimingHistoryTests, RingReuseAndStaleSamples) {
+    TimingHistory hist({{{kSec, 4}, {kSec, 4}, {kSec, 4}}});
+    hist.record(0, 1.0);
+    hist.record(4 * kSec, 9.0); // same slot as epoch 0, newer -> replaces
+    hist.record(0, 3.0);        // stale for that slot -> ignored
+    auto s = hist.queryTier(0, 0, 5 * kSec);
+    EXPECT_EQ(s.count, 1u);
+    EXPECT_DOUBLE_EQ(s.mean, 9.0);
+    hist.clear();
+    EXPECT_EQ(hist.query(0, 10 * kSec).count, 0u);
+}
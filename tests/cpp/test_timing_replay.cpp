@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include "../../lib/Standards/AES/AES11/2009/sync/timing_replay.hpp"
+#include "../../lib/Standards/Common/clocks/linux_clocks.hpp"
+
+using AES::AES11::_2009::core::TimingSnapshotService;
+using AES::AES11::_2009::sync::ReplayEvent;
+using AES::AES11::_2009::sync::SynchronizationManager;
+using AES::AES11::_2009::sync::SyntheticTimeline;
+using AES::AES11::_2009::sync::TimingReplay;
+using AES::AES11::_2009::sync::VectorTimeline;
+using Common::testing::VirtualClock;
+
+namespace {
+constexpr uint64_t kSecond = 1'000'000'000ULL;
+
+// 48 kHz decimated to 100 TRPs/s per source.
+SyntheticTimeline::Config timeline(std::vector<SyntheticTimeline::Source> sources, uint64_t seconds) {
+    SyntheticTimeline::Config cfg;
+    cfg.trpDecimation = 480;
+    cfg.sources = std::move(sources);
+    cfg.durationNs = seconds * kSecond;
+    return cfg;
+}
+
+TimingReplay::Config replay(size_t sources) {
+    TimingReplay::Config cfg;
+    cfg.sourceCount = sources;
+    cfg.trpDecimation = 480;
+    return cfg;
+}
+} // namespace
+
+// Verifies: REQ-NF-REL-004
+// TEST-TIMESRC-REPLAY-001: Virtual clock only moves when advanced and snapshots exactly
+TEST(TimingReplayTests, VirtualClockIsDeterministic) {
+    VirtualClock clk(1000, 3);
+    TimingSnapshotService<VirtualClock> svc(clk);
+    auto a = svc.snapshot();
+    auto b = svc.snapshot();
+    EXPECT_EQ(a.time_ns, 1000u);
+    EXPECT_EQ(b.time_ns, 1000u);
+    EXPECT_EQ(a.tick, 3000u);
+    EXPECT_EQ(a.uncertainty_ticks, 0u);
+    clk.advance_to(500); // backwards: ignored
+    EXPECT_EQ(clk.now_ns(), 1000u);
+    clk.advance_by(kSecond);
+    EXPECT_EQ(svc.snapshot().time_ns, 1000u + kSecond);
+
+    Common::clocks::ClockInterfaceAdapter<VirtualClock> adapted(clk);
+    TimingSnapshotService<> virtualSvc(adapted);
+    EXPECT_EQ(virtualSvc.snapshot().tick, 3 * (1000u + kSecond));
+}
+
+// Verifies: REQ-F-SYNC-001, REQ-F-DARS-006
+// TEST-TIMESRC-REPLAY-002: Simulated hour selects the PPS-aligned source, faster than real time
+TEST(TimingReplayTests, SimulatedHourSelectsAlignedSource) {
+    SyntheticTimeline tl(timeline({{0.0, 10.0, 0, 0, 0},       // aligned
+                                   {0.0, 10.0, 5'000, 0, 0}},  // 5 µs late vs PPS
+                                  3600));
+    TimingReplay r(replay(2));
+    const TimingReplay::Report rep = r.run(tl);
+    EXPECT_EQ(rep.ppsEvents, 3600u);
+    EXPECT_EQ(rep.trpEvents, 2u * 3600u * 100u);
+    EXPECT_EQ(rep.selected, 0u);
+    EXPECT_EQ(rep.switches, 0u);
+    EXPECT_GE(rep.selections, 3598u);
+    EXPECT_EQ(r.source(0).ppsAligned, 3600u);
+    EXPECT_EQ(r.source(1).ppsMisaligned, 3600u);
+    EXPECT_NEAR(r.source(1).lastPhaseOffsetUs, 5.0, 0.05);
+    EXPECT_NEAR(static_cast<double>(rep.simulatedNs), 3600e9 - 10e6 + 5e3, 10.0); // last TRP ± jitter
+    EXPECT_GT(rep.simulatedSecondsPerWallSecond(), 1.0);
+}
+
+// Verifies: REQ-F-SYNC-001
+// TEST-TIMESRC-REPLAY-003: Dropout forces one switch; hysteresis holds after recovery
+TEST(TimingReplayTests, DropoutSwitchesOnceAndHolds) {
+    SyntheticTimeline tl(timeline({{0.0, 5.0, 0, 600 * kSecond, 1200 * kSecond},
+                                   {0.0, 20.0, 0, 0, 0}},
+                                  1800));
+    TimingReplay r(replay(2));
+    const TimingReplay::Report rep = r.run(tl);
+    EXPECT_EQ(rep.switches, 1u);
+    EXPECT_EQ(rep.selected, 1u);
+    EXPECT_GE(r.source(0).ppsMisaligned, 599u);
+    EXPECT_EQ(r.source(1).ppsMisaligned, 0u);
+}
+
+// Verifies: REQ-NF-REL-004
+// TEST-TIMESRC-REPLAY-004: Recorded replay of a synthetic run reproduces its report
+TEST(TimingReplayTests, RecordedReplayMatchesSynthetic) {
+    auto cfg = timeline({{1.0, 50.0, 0, 0, 0}, {0.0, 50.0, 200, 30 * kSecond, 40 * kSecond}}, 120);
+    cfg.seed = 42;
+    SyntheticTimeline tl(cfg);
+    std::vector<ReplayEvent> recorded;
+    ReplayEvent ev{};
+    while (tl.next(ev)) recorded.push_back(ev);
+    ASSERT_FALSE(recorded.empty());
+    for (size_t i = 1; i < recorded.size(); ++i) ASSERT_LE(recorded[i - 1].timeNs, recorded[i].timeNs);
+
+    tl.rewind();
+    TimingReplay a(replay(2));
+    const auto ra = a.run(tl);
+    VectorTimeline vt(recorded);
+    TimingReplay b(replay(2));
+    const auto rb = b.run(vt);
+    EXPECT_EQ(ra.events, recorded.size());
+    EXPECT_EQ(ra.events, rb.events);
+    EXPECT_EQ(ra.selections, rb.selections);
+    EXPECT_EQ(ra.switches, rb.switches);
+    EXPECT_EQ(ra.ppsAligned, rb.ppsAligned);
+    EXPECT_EQ(ra.selected, rb.selected);
+    EXPECT_EQ(ra.simulatedNs, rb.simulatedNs);
+    EXPECT_EQ(b.clock().now_ns(), recorded.back().timeNs);
+}
+
+// Verifies: REQ-F-SYNC-001
+// TEST-TIMESRC-REPLAY-005: Empty timeline leaves nothing selected
+TEST(TimingReplayTests, EmptyTimeline) {
+    std::vector<ReplayEvent> none;
+    VectorTimeline vt(none);
+    TimingReplay r(replay(3));
+    const auto rep = r.run(vt);
+    EXPECT_EQ(rep.events, 0u);
+    EXPECT_EQ(rep.simulatedNs, 0u);
+    EXPECT_EQ(rep.selected, SynchronizationManager::invalidIndex());
+}
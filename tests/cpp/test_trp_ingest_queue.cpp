@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include "../../lib/Standards/AES/AES11/2009/core/trp_ingest_queue.hpp"
+#include <thread>
+#include <vector>
+
+using AES::AES11::_2009::core::TimingWindowProcessor;
+using AES::AES11::_2009::core::TrpIngestQueue;
+using Common::concurrency::SpscRing;
+
+// Verifies: REQ-NF-PERF-001
+// TEST-UNIT-SpscRing-001: Capacity rounds to power of two; FIFO order; full/empty detection
+TEST(SpscRingTests, FifoOrderAndBounds) {
+    SpscRing<int> ring(5);
+    EXPECT_EQ(ring.capacity(), 8u);
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_TRUE(ring.try_push(i));
+    }
+    EXPECT_FALSE(ring.try_push(99)) << "Ring should reject pushes when full";
+    int v = -1;
+    for (int i = 0; i < 8; ++i) {
+        ASSERT_TRUE(ring.try_pop(v));
+        EXPECT_EQ(v, i);
+    }
+    EXPECT_FALSE(ring.try_pop(v));
+}
+
+// Verifies: REQ-NF-PERF-001
+// TEST-UNIT-SpscRing-002: Concurrent producer/consumer delivers every element in order
+TEST(SpscRingTests, ConcurrentTransferPreservesOrder) {
+    SpscRing<uint64_t> ring(64);
+    constexpr uint64_t total = 50'000;
+    std::thread producer([&]() {
+        for (uint64_t i = 1; i <= total; ++i) {
+            while (!ring.try_push(i)) std::this_thread::yield();
+        }
+    });
+    uint64_t expected = 1;
+    bool ordered = true;
+    while (expected <= total) {
+        size_t n = ring.drain([&](uint64_t x) {
+            if (x != expected) ordered = false;
+            ++expected;
+        });
+        if (n == 0) std::this_thread::yield();
+    }
+    producer.join();
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(ring.size_approx(), 0u);
+}
+
+// Verifies: REQ-NF-PERF-001, REQ-NF-PERF-003
+// TEST-UNIT-TrpIngest-001: Drained TRP timestamps become intervals in the timing window
+TEST(TrpIngestQueueTests, DrainIntoWindowFeedsIntervals) {
+    TrpIngestQueue q(16);
+    TimingWindowProcessor win(8, 1.0);
+    const uint64_t period = 20'833; // ~48 kHz frame period in ns
+    for (uint64_t i = 0; i < 5; ++i) {
+        ASSERT_TRUE(q.push(1'000'000'000ULL + i * period));
+    }
+    EXPECT_EQ(q.drain_into(win), 5u);
+    auto m = win.metrics();
+    EXPECT_EQ(m.count, 4u) << "First TRP only primes the interval reference";
+    EXPECT_NEAR(m.mean, static_cast<double>(period), 1e-9);
+    EXPECT_NEAR(m.variance, 0.0, 1e-9);
+}
+
+// Verifies: REQ-NF-PERF-001
+// TEST-UNIT-TrpIngest-002: Overflow drops newest TRP and counts it instead of blocking
+TEST(TrpIngestQueueTests, OverflowCountsDrops) {
+    TrpIngestQueue q(4);
+    for (uint64_t i = 0; i < 6; ++i) q.push(i);
+    EXPECT_EQ(q.dropped(), 2u);
+    std::vector<uint64_t> seen;
+    q.drain([&](uint64_t t) { seen.push_back(t); });
+    EXPECT_EQ(seen, (std::vector<uint64_t>{0, 1, 2, 3}));
+}
+
+// Verifies: REQ-NF-PERF-001, REQ-NF-PERF-003
+// TEST-UNIT-TrpIngest-003: No interval is formed across TRPs dropped on overflow
+TEST(TrpIngestQueueTests, OverflowGapDoesNotInflateVariance) {
+    TrpIngestQueue q(4);
+    TimingWindowProcessor win(16, 1.0);
+    const uint64_t period = 20'833;
+    uint64_t t = 1'000'000'000ULL;
+    for (int i = 0; i < 6; ++i, t += period) q.push(t); // last two are dropped
+    EXPECT_EQ(q.dropped(), 2u);
+    EXPECT_EQ(q.drain_into(win), 4u);
+    for (int i = 0; i < 4; ++i, t += period) ASSERT_TRUE(q.push(t)); // resumes after the gap
+    EXPECT_EQ(q.drain_into(win), 4u);
+
+    auto m = win.metrics();
+    EXPECT_EQ(m.count, 6u) << "3 intervals before the gap, 3 after; none across it";
+    EXPECT_NEAR(m.mean, static_cast<double>(period), 1e-9);
+    EXPECT_NEAR(m.variance, 0.0, 1e-9);
+
+    // Raw drain strips the marker.
+    q.push(t);
+    q.push(t + period);
+    q.push(t + 2 * period);
+    q.push(t + 3 * period);
+    q.push(t + 4 * period); // dropped
+    std::vector<uint64_t> seen;
+    q.drain([&](uint64_t v) { seen.push_back(v); });
+    ASSERT_TRUE(q.push(t + 5 * period));
+    q.drain([&](uint64_t v) { seen.push_back(v); });
+    EXPECT_EQ(seen.back(), t + 5 * period);
+}